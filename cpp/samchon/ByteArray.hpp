@@ -2,6 +2,11 @@
 
 #include <vector>
 #include <string>
+#include <algorithm>
+#include <stdexcept>
+#include <climits>
+#include <cstdint>
+#include <zlib.h>
 
 namespace samchon
 {
@@ -234,11 +239,13 @@ namespace samchon
 		 * <p> Generates a binary data compressed from the ByteArray. </p>
 		 * <p> The binary data will be compressed by zlib library. </p>
 		 * 
+		 * @param level Compression level of zlib, from 0 (no compression) to 9 (best compression)
+		 * @throw runtime_error failed to compress
 		 * @return ByteArray which is compressed
 		 */
-		auto compress() const -> ByteArray
+		auto compress(int level = Z_DEFAULT_COMPRESSION) const -> ByteArray
 		{
-			return{};
+			return compress(data(), size(), level);
 		};
 
 		/**
@@ -248,11 +255,136 @@ namespace samchon
 		 * <p> Generates a decompressed binary data form the ByteArray. </p>
 		 * <p> The binary data will be decompressed by zlib library. </p>
 		 * 
+		 * @param max_size Maximum size of the decompressed data
+		 * @throw runtime_error the ByteArray is not a data compressed by zlib
+		 * @throw length_error the decompressed data exceeds the <i>max_size</i>
 		 * @return ByteArray that is decompressed
 		 */
-		auto decompress() const -> ByteArray
+		auto decompress(size_t max_size = SIZE_MAX) const -> ByteArray
 		{
-			return{};
+			return decompress(data(), size(), max_size);
+		};
+
+		/**
+		 * @brief Compress a binary data
+		 *
+		 * @details Compresses a binary data which is not contained in a ByteArray, like a buffer of socket.
+		 *
+		 * @param data Pointer of the binary data
+		 * @param size Size of the binary data
+		 * @param level Compression level of zlib, from 0 (no compression) to 9 (best compression)
+		 * @throw runtime_error failed to compress
+		 * @return ByteArray which is compressed
+		 */
+		static auto compress(const unsigned char *data, size_t size, int level = Z_DEFAULT_COMPRESSION) -> ByteArray
+		{
+			z_stream stream = {};
+			if (deflateInit(&stream, level) != Z_OK)
+				throw std::runtime_error("Failed to initialize zlib.");
+
+			// BOUND OF THE COMPRESSED SIZE, MOSTLY DEFLATED AT ONCE
+			ByteArray compressed;
+			if (size <= UINT_MAX / 2)
+				compressed.resize(deflateBound(&stream, (uLong)size));
+			else
+				compressed.resize(size + size / 1000 + 1024);
+
+			size_t completed = 0;
+			int result;
+			do
+			{
+				feed_stream(stream, data, size);
+				if (completed == compressed.size())
+					compressed.resize(compressed.size() * 2);
+
+				uInt capacity = (uInt)std::min<size_t>(compressed.size() - completed, UINT_MAX);
+				stream.next_out = compressed.data() + completed;
+				stream.avail_out = capacity;
+
+				result = deflate(&stream, (size == 0) ? Z_FINISH : Z_NO_FLUSH);
+				completed += capacity - stream.avail_out;
+			}
+			while (result == Z_OK || result == Z_BUF_ERROR);
+
+			compressed.resize(completed);
+
+			deflateEnd(&stream);
+			if (result != Z_STREAM_END)
+				throw std::runtime_error("Failed to compress.");
+
+			return compressed;
+		};
+
+		/**
+		 * @brief Decompress a binary data
+		 *
+		 * @details Decompresses a binary data which is not contained in a ByteArray, like a buffer of socket.
+		 *
+		 * @param data Pointer of the compressed data
+		 * @param size Size of the compressed data
+		 * @param max_size Maximum size of the decompressed data
+		 * @throw runtime_error the data is not compressed by zlib
+		 * @throw length_error the decompressed data exceeds the <i>max_size</i>
+		 * @return ByteArray that is decompressed
+		 */
+		static auto decompress(const unsigned char *data, size_t size, size_t max_size = SIZE_MAX) -> ByteArray
+		{
+			z_stream stream = {};
+			if (inflateInit(&stream) != Z_OK)
+				throw std::runtime_error("Failed to initialize zlib.");
+
+			// A BYTE MORE THAN THE MAX_SIZE, TO DETECT THE EXCESS
+			size_t limit = (max_size == SIZE_MAX) ? max_size : max_size + 1;
+
+			// INFLATE, GROWING THE BUFFER UNTIL THE STREAM ENDS
+			ByteArray decompressed;
+			decompressed.resize(std::min<size_t>((size < limit / 4) ? std::max<size_t>(size * 4, 1024) : limit, limit));
+
+			size_t completed = 0;
+			int result;
+			do
+			{
+				feed_stream(stream, data, size);
+				if (completed == decompressed.size())
+				{
+					if (completed == limit)
+						break;
+					decompressed.resize((decompressed.size() < limit / 2) ? decompressed.size() * 2 : limit);
+				}
+
+				uInt capacity = (uInt)std::min<size_t>(decompressed.size() - completed, UINT_MAX);
+				stream.next_out = decompressed.data() + completed;
+				stream.avail_out = capacity;
+
+				result = inflate(&stream, Z_NO_FLUSH);
+				completed += capacity - stream.avail_out;
+			}
+			while (result == Z_OK);
+
+			inflateEnd(&stream);
+			if (completed > max_size)
+				throw std::length_error("Decompressed data is too large.");
+			else if (result != Z_STREAM_END)
+				throw std::runtime_error("Invalid compressed data.");
+
+			decompressed.resize(completed);
+			return decompressed;
+		};
+
+	private:
+		/**
+		 * @brief Feed the next piece of input to a zlib stream, whose size is 32 bits
+		 */
+		static void feed_stream(z_stream &stream, const unsigned char *&data, size_t &size)
+		{
+			if (stream.avail_in != 0 || size == 0)
+				return;
+
+			stream.next_in = (Bytef*)data;
+			stream.avail_in = (uInt)std::min<size_t>(size, UINT_MAX);
+
+			data += stream.avail_in;
+			size -= stream.avail_in;
 		};
 	};
 };
\ No newline at end of file
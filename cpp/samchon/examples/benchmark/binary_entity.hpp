@@ -0,0 +1,109 @@
+#pragma once
+
+#include <iostream>
+#include <samchon/protocol/Invoke.hpp>
+#include <samchon/examples/tsp/Travel.hpp>
+#include <samchon/examples/benchmark/measure.hpp>
+
+namespace samchon
+{
+namespace examples
+{
+namespace benchmark
+{
+namespace binary_entity
+{
+	/**
+	 * Serializing an {@link Entity} in XML and binary.
+	 *
+	 * Compares ```toXML()->toString()``` and ```construct(XML)``` with ```toByteArray()``` and
+	 * ```construct(ByteArray)```, using a {@link tsp::Travel} of 100,000 points whose fields are declared once by
+	 * {@link protocol::EntityBase.archive archive()}. Also counts points whose coordinates are not restored
+	 * exactly by XML.
+	 */
+	void main()
+	{
+		using namespace std;
+		using namespace samchon::library;
+		using namespace samchon::protocol;
+		using namespace samchon::examples::tsp;
+
+		const size_t COUNT = 100 * 1000;
+		const size_t REPEAT = 10;
+
+		// A TRAVEL OF RANDOM POINTS
+		Travel travel;
+		for (size_t i = 0; i < COUNT; i++)
+			travel.emplace_back(new GeometryPoint((int)i + 1, Math::random() * 360 - 180, Math::random() * 180 - 90));
+
+		string xml_str = travel.toXML()->toString();
+		ByteArray binary = travel.toByteArray();
+
+		cout << "-------------------------------------------------------------" << endl;
+		cout << "	Serialize a Travel of " << COUNT << " points" << endl;
+		cout << "-------------------------------------------------------------" << endl;
+		cout << "XML size: " << xml_str.size() << " bytes, binary size: " << binary.size() << " bytes" << endl << endl;
+
+		measure("XML encode", REPEAT, [&]()
+		{
+			string str = travel.toXML()->toString();
+		});
+		measure("binary encode", REPEAT, [&]()
+		{
+			ByteArray data = travel.toByteArray();
+		});
+		measure("XML decode", REPEAT, [&]()
+		{
+			Travel obj;
+			obj.construct(make_shared<XML>(xml_str));
+		});
+		measure("binary decode", REPEAT, [&]()
+		{
+			binary.set_position(0);
+
+			Travel obj;
+			EntityBase *base = &obj;
+			base->construct(binary);
+		});
+
+		// THROUGH AN INVOKE MESSAGE, AS A BYTE_ARRAY PARAMETER
+		measure("binary by Invoke", REPEAT, [&]()
+		{
+			shared_ptr<Invoke> invoke(new Invoke("setTravel", travel.toByteArray()));
+			ByteArray message = invoke->toByteArray();
+
+			shared_ptr<Invoke> replied(new Invoke());
+			replied->construct(message);
+
+			Travel obj;
+			EntityBase *base = &obj;
+			base->construct(replied->front()->referValue<ByteArray>());
+		});
+
+		//--------
+		// PRECISION
+		//--------
+		Travel xml_travel;
+		Travel binary_travel;
+		EntityBase *base = &binary_travel;
+
+		xml_travel.construct(make_shared<XML>(xml_str));
+		binary.set_position(0);
+		base->construct(binary);
+
+		size_t xml_lost = 0;
+		size_t binary_lost = 0;
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			if (xml_travel[i]->calcDistance(*travel[i]) != 0.0)
+				xml_lost++;
+			if (binary_travel[i]->calcDistance(*travel[i]) != 0.0)
+				binary_lost++;
+		}
+		cout << endl << "points not restored exactly - XML: " << xml_lost << ", binary: " << binary_lost << endl;
+	};
+};
+};
+};
+};
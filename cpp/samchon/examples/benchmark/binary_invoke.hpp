@@ -0,0 +1,69 @@
+#pragma once
+
+#include <iostream>
+#include <samchon/protocol/Invoke.hpp>
+#include <samchon/examples/benchmark/measure.hpp>
+
+namespace samchon
+{
+namespace examples
+{
+namespace benchmark
+{
+namespace binary_invoke
+{
+	/**
+	 * Encoding & decoding {@link Invoke} messages in XML and binary.
+	 *
+	 * Compares the XML path of {@link protocol::Communicator}, ```toXML()->toString()``` and 
+	 * ```XML(string) -> Invoke::construct()```, with the binary path, ```toByteArray()``` and 
+	 * ```Invoke::construct(ByteArray)```, using a message of numbers and short strings that master and slave 
+	 * systems exchange.
+	 */
+	void main()
+	{
+		using namespace std;
+		using namespace samchon::library;
+		using namespace samchon::protocol;
+
+		const size_t COUNT = 100 * 1000;
+
+		// A TYPICAL MESSAGE BETWEEN MASTER AND SLAVE
+		shared_ptr<Invoke> invoke(new Invoke("computePlus", 3.141592, 2.718281, 1024, "samchon", "127.0.0.1"));
+		invoke->emplace_back(new InvokeParameter("_History_uid", 15));
+		invoke->emplace_back(new InvokeParameter("_Piece_first", 0));
+		invoke->emplace_back(new InvokeParameter("_Piece_last", 100));
+
+		string xml_str = invoke->toXML()->toString();
+		ByteArray binary = invoke->toByteArray();
+
+		cout << "-------------------------------------------------------------" << endl;
+		cout << "	Encode & decode Invoke messages" << endl;
+		cout << "-------------------------------------------------------------" << endl;
+		cout << "XML size: " << xml_str.size() << " bytes, binary size: " << binary.size() << " bytes" << endl << endl;
+
+		measure("XML encode", COUNT, [&]()
+		{
+			string str = invoke->toXML()->toString();
+		});
+		measure("binary encode", COUNT, [&]()
+		{
+			ByteArray data = invoke->toByteArray();
+		});
+		measure("XML decode", COUNT, [&]()
+		{
+			shared_ptr<Invoke> obj(new Invoke());
+			obj->construct(make_shared<XML>(xml_str));
+		});
+		measure("binary decode", COUNT, [&]()
+		{
+			binary.set_position(0);
+
+			shared_ptr<Invoke> obj(new Invoke());
+			obj->construct(binary);
+		});
+	};
+};
+};
+};
+};
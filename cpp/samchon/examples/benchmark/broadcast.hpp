@@ -0,0 +1,95 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <samchon/protocol/WebCommunicator.hpp>
+#include <samchon/examples/benchmark/measure.hpp>
+
+namespace samchon
+{
+namespace examples
+{
+namespace benchmark
+{
+namespace broadcast
+{
+	/**
+	 * A communicator encoding messages, without connection.
+	 */
+	class Peer
+		: public protocol::WebCommunicator
+	{
+	public:
+		Peer(bool web)
+			: protocol::Communicator(),
+			protocol::WebCommunicator(true)
+		{
+			this->web = web;
+		};
+
+		auto encode(std::shared_ptr<protocol::Invoke> invoke) -> size_t
+		{
+			std::shared_ptr<OutboundMessage> message = web
+				? protocol::WebCommunicator::encode_message(invoke)
+				: protocol::Communicator::encode_message(invoke);
+
+			return message->size;
+		};
+
+		virtual void replyData(std::shared_ptr<protocol::Invoke>) override
+		{
+		};
+
+	private:
+		bool web;
+	};
+
+	/**
+	 * Encoding an {@link protocol::Invoke} message for 500 peers, by each peer and once by
+	 * {@link protocol::InvokeFrame}.
+	 *
+	 * The message has 100 parameters, like a list of a chat room. Only encoding is measured, thus the difference is
+	 * what a broadcast saves from building XML objects and strings for each peer.
+	 */
+	void main()
+	{
+		using namespace std;
+		using namespace samchon::protocol;
+
+		const size_t PEERS = 500;
+		const size_t REPEAT = 10;
+
+		shared_ptr<Invoke> invoke(new Invoke("setMessages"));
+		for (size_t i = 0; i < 100; i++)
+			invoke->emplace_back(new InvokeParameter("message", "A message to everyone in the room, #" + to_string(i)));
+
+		cout << "-------------------------------------------------------------" << endl;
+		cout << "	Encode a message for " << PEERS << " peers" << endl;
+		cout << "-------------------------------------------------------------" << endl;
+
+		for (size_t w = 0; w < 2; w++)
+		{
+			vector<unique_ptr<Peer>> peers;
+			for (size_t i = 0; i < PEERS; i++)
+				peers.emplace_back(new Peer(w == 1));
+
+			string name = (w == 0) ? "TCP" : "web-socket";
+
+			measure(name + ", by each peer", REPEAT, [&]()
+			{
+				for (size_t i = 0; i < peers.size(); i++)
+					peers[i]->encode(invoke);
+			});
+			measure(name + ", by InvokeFrame", REPEAT, [&]()
+			{
+				InvokeFrame::Scope scope(invoke);
+
+				for (size_t i = 0; i < peers.size(); i++)
+					peers[i]->encode(invoke);
+			});
+		}
+	};
+};
+};
+};
+};
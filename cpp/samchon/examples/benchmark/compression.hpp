@@ -0,0 +1,76 @@
+#pragma once
+
+#include <iostream>
+#include <iomanip>
+#include <samchon/ByteArray.hpp>
+#include <samchon/protocol/Invoke.hpp>
+#include <samchon/examples/packer/ProductArray.hpp>
+#include <samchon/examples/benchmark/measure.hpp>
+
+namespace samchon
+{
+namespace examples
+{
+namespace benchmark
+{
+namespace compression
+{
+	/**
+	 * Break-even point of frame compression.
+	 *
+	 * Compressing a frame, {@link protocol::Communicator.setCompressionThreshold}, saves bytes to transfer but costs
+	 * time to compress and decompress. For XML {@link Invoke} messages carrying products of the packer example,
+	 * prints the compression ratio, time of compression & decompression and the break-even bandwidth; compression
+	 * pays on networks slower than the bandwidth.
+	 */
+	void main()
+	{
+		using namespace std;
+		using namespace samchon::library;
+		using namespace samchon::protocol;
+		using namespace samchon::examples::packer;
+
+		cout << "-------------------------------------------------------------" << endl;
+		cout << "	Break-even point of compression" << endl;
+		cout << "-------------------------------------------------------------" << endl;
+
+		for (size_t count = 1; count <= 10000; count *= 10)
+		{
+			// XML MESSAGE OF PRODUCTS
+			ProductArray products;
+			for (size_t i = 0; i < count; i++)
+				products.emplace_back(new Product("Product #" + to_string(i), 1000 + (int)(i % 97) * 10, 10 + (int)(i % 13), 5 + (int)(i % 7)));
+
+			shared_ptr<Invoke> invoke(new Invoke("setProducts"));
+			invoke->emplace_back(new InvokeParameter("products", products.toXML()));
+
+			string str = invoke->toXML()->toString();
+			ByteArray data;
+			data.assign(str.begin(), str.end());
+
+			ByteArray compressed = data.compress();
+			size_t repeat = max<size_t>(10, 1000 * 1000 / data.size());
+
+			cout << endl << count << " products, " << data.size() << " bytes -> " << compressed.size() << " bytes ("
+				<< fixed << setprecision(2) << (double)data.size() / compressed.size() << "x)" << endl;
+
+			double compress_time = measure("compress", repeat, [&]()
+			{
+				ByteArray ret = data.compress();
+			}) / repeat;
+			double decompress_time = measure("decompress", repeat, [&]()
+			{
+				ByteArray ret = compressed.decompress();
+			}) / repeat;
+
+			// SAVED BITS PER SECOND SPENT
+			double saved_bits = (double)(data.size() - compressed.size()) * 8;
+			double break_even = saved_bits / ((compress_time + decompress_time) / 1000.0) / (1000 * 1000);
+
+			cout << "break-even bandwidth: " << fixed << setprecision(2) << break_even << " Mbps" << endl;
+		}
+	};
+};
+};
+};
+};
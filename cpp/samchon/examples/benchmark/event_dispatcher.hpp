@@ -0,0 +1,198 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <map>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <samchon/library/EventDispatcher.hpp>
+#include <samchon/library/ProgressEvent.hpp>
+#include <samchon/examples/benchmark/measure.hpp>
+
+namespace samchon
+{
+namespace examples
+{
+namespace benchmark
+{
+namespace event_dispatcher
+{
+	/**
+	 * Delivery like the former {@link library::EventDispatcher}: a global queue behind a global mutex, all workers
+	 * woken for each event, and listeners of the event type copied for each delivery.
+	 */
+	class GlobalQueue
+	{
+	private:
+		typedef std::function<void(std::shared_ptr<library::Event>)> Listener;
+
+		std::map<int, std::vector<Listener>> listeners;
+		std::deque<std::shared_ptr<library::Event>> queue;
+		std::mutex mtx;
+		std::condition_variable cv;
+
+		bool stopped;
+		std::vector<std::thread> threads;
+
+	public:
+		GlobalQueue(size_t size)
+		{
+			stopped = false;
+
+			for (size_t i = 0; i < size; i++)
+				threads.emplace_back([this]()
+				{
+					std::unique_lock<std::mutex> uk(mtx);
+					while (true)
+					{
+						if (queue.empty() == true)
+						{
+							if (stopped == true)
+								return;
+
+							cv.wait(uk);
+							continue;
+						}
+
+						std::shared_ptr<library::Event> event = queue.front();
+						queue.pop_front();
+
+						std::vector<Listener> copied = listeners[event->getType()];
+						uk.unlock();
+						{
+							for (size_t i = 0; i < copied.size(); i++)
+								copied[i](event);
+						}
+						uk.lock();
+					}
+				});
+		};
+		~GlobalQueue()
+		{
+			{
+				std::unique_lock<std::mutex> uk(mtx);
+				stopped = true;
+			}
+			cv.notify_all();
+
+			for (size_t i = 0; i < threads.size(); i++)
+				threads[i].join();
+		};
+
+		void addEventListener(int type, Listener listener)
+		{
+			std::unique_lock<std::mutex> uk(mtx);
+			listeners[type].push_back(listener);
+		};
+
+		void dispatch(std::shared_ptr<library::Event> event)
+		{
+			std::unique_lock<std::mutex> uk(mtx);
+			queue.push_back(event);
+
+			cv.notify_all();
+		};
+	};
+
+	/**
+	 * Delivery of {@link library::ProgressEvent ProgressEvents}; 4 threads dispatch 1,000 events for each of 64
+	 * sources, like progresses of many {@link library::GeneticAlgorithm} jobs.
+	 *
+	 * Measures time until all the events are delivered, by the {@link library::EventDispatcher} and by a global
+	 * queue. Events delivered out of order of the dispatch are counted, too.
+	 */
+	void main()
+	{
+		using namespace std;
+		using namespace samchon::library;
+
+		const size_t SOURCES = 64;
+		const size_t EVENTS = 1000;
+		const size_t PRODUCERS = 4;
+
+		atomic<size_t> delivered(0);
+		atomic<size_t> disordered(0);
+
+		// LAST NUMERATOR DELIVERED, FOR EACH SOURCE
+		vector<atomic<size_t>> lasts(SOURCES);
+		auto listener = [&](shared_ptr<Event> event, size_t index)
+		{
+			size_t numerator = static_pointer_cast<ProgressEvent>(event)->getNumerator();
+			if (lasts[index].exchange(numerator) != numerator - 1)
+				disordered++;
+
+			delivered++;
+		};
+
+		auto produce = [&](function<void(size_t, size_t)> dispatch)
+		{
+			delivered = 0;
+			disordered = 0;
+			for (size_t i = 0; i < SOURCES; i++)
+				lasts[i] = 0;
+
+			vector<thread> threads;
+			for (size_t p = 0; p < PRODUCERS; p++)
+				threads.emplace_back([&, p]()
+				{
+					for (size_t i = p; i < SOURCES; i += PRODUCERS)
+						for (size_t n = 1; n <= EVENTS; n++)
+							dispatch(i, n);
+				});
+			for (size_t i = 0; i < threads.size(); i++)
+				threads[i].join();
+
+			while (delivered != SOURCES * EVENTS)
+				this_thread::yield();
+		};
+
+		cout << "-------------------------------------------------------------" << endl;
+		cout << "	" << SOURCES * EVENTS << " progress events of " << SOURCES << " sources" << endl;
+		cout << "-------------------------------------------------------------" << endl;
+
+		vector<unique_ptr<EventDispatcher>> dispatchers;
+		for (size_t i = 0; i < SOURCES; i++)
+		{
+			dispatchers.emplace_back(new EventDispatcher());
+			dispatchers.back()->addEventListener(ProgressEvent::PROGRESS, [&listener, i](shared_ptr<Event> event, void*)
+			{
+				listener(event, i);
+			});
+		}
+
+		measure("EventDispatcher", 1, [&]()
+		{
+			produce([&](size_t i, size_t n)
+			{
+				dispatchers[i]->dispatch(make_shared<ProgressEvent>(dispatchers[i].get(), n, EVENTS));
+			});
+		});
+		cout << "	disordered: " << disordered << endl;
+
+		GlobalQueue global(2);
+		global.addEventListener(ProgressEvent::PROGRESS, [&](shared_ptr<Event> event)
+		{
+			for (size_t i = 0; i < SOURCES; i++)
+				if (event->getSource() == dispatchers[i].get())
+				{
+					listener(event, i);
+					break;
+				}
+		});
+
+		measure("global queue, 2 threads", 1, [&]()
+		{
+			produce([&](size_t i, size_t n)
+			{
+				global.dispatch(make_shared<ProgressEvent>(dispatchers[i].get(), n, EVENTS));
+			});
+		});
+		cout << "	disordered: " << disordered << endl;
+	};
+};
+};
+};
+};
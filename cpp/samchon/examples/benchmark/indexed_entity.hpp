@@ -0,0 +1,108 @@
+#pragma once
+
+#include <iostream>
+#include <iomanip>
+#include <samchon/protocol/InvokeParameter.hpp>
+#include <samchon/protocol/SharedEntityArray.hpp>
+#include <samchon/protocol/IndexedEntityArray.hpp>
+#include <samchon/examples/benchmark/measure.hpp>
+
+namespace samchon
+{
+namespace examples
+{
+namespace benchmark
+{
+namespace indexed_entity
+{
+	/**
+	 * Lookups by key, scanning an {@link protocol::EntityGroup} and by {@link protocol::IndexedEntityGroup}.
+	 *
+	 * Groups of {@link protocol::InvokeParameter parameters}, whose keys are names, are built in sizes from 2 to 
+	 * 4,096. Each group is looked up by {@link protocol::EntityGroup.has has()} and 
+	 * {@link protocol::EntityGroup.get get()} for all of its keys, like {@link protocol::Invoke} messages are 
+	 * looked up for *_History_uid* and *_Piece_first*. Building the index after construction is included. Prints
+	 * nanoseconds per lookup of each and the crossover size.
+	 */
+	template <typename Group>
+	class ParameterGroup
+		: public Group
+	{
+	public:
+		virtual auto TAG() const -> std::string override
+		{
+			return "invoke";
+		};
+		virtual auto CHILD_TAG() const -> std::string override
+		{
+			return "parameter";
+		};
+
+	protected:
+		virtual auto createChild(std::shared_ptr<library::XML>) -> protocol::InvokeParameter* override
+		{
+			return new protocol::InvokeParameter();
+		};
+	};
+
+	template <typename Group>
+	auto measure_lookups(size_t size, size_t repeat) -> double
+	{
+		std::vector<std::string> keys;
+		for (size_t i = 0; i < size; i++)
+			keys.push_back("_Parameter_" + std::to_string(i));
+
+		size_t found = 0;
+		auto first = std::chrono::high_resolution_clock::now();
+		for (size_t r = 0; r < repeat; r++)
+		{
+			// A NEW GROUP, LIKE A RECEIVED MESSAGE
+			ParameterGroup<Group> group;
+			for (size_t i = 0; i < size; i++)
+				group.emplace_back(new protocol::InvokeParameter(keys[i], (int)i));
+
+			for (size_t i = 0; i < size; i++)
+				if (group.has(keys[i]) == true)
+					found += group.get(keys[i])->template getValue<int>() >= 0;
+		}
+		auto last = std::chrono::high_resolution_clock::now();
+
+		if (found != size * repeat)
+			std::cout << "lookup failed" << std::endl;
+
+		double elapsed = std::chrono::duration<double, std::nano>(last - first).count();
+		return elapsed / (size * repeat * 2);
+	};
+
+	void main()
+	{
+		using namespace std;
+		using namespace samchon::protocol;
+
+		cout << "-------------------------------------------------------------" << endl;
+		cout << "	Lookups by key: scan vs hash index" << endl;
+		cout << "-------------------------------------------------------------" << endl;
+		cout << setw(8) << "size" << setw(16) << "scan (ns)" << setw(16) << "index (ns)" << endl;
+
+		size_t crossover = 0;
+		for (size_t size = 2; size <= 4096; size *= 2)
+		{
+			size_t repeat = max<size_t>(1, 1000 * 1000 / (size * size + size * 64));
+
+			double scan = measure_lookups<SharedEntityArray<InvokeParameter>>(size, repeat);
+			double index = measure_lookups<IndexedEntityArray<InvokeParameter>>(size, repeat);
+
+			cout << setw(8) << size << setw(16) << fixed << setprecision(1) << scan << setw(16) << index << endl;
+			if (crossover == 0 && index < scan)
+				crossover = size;
+		}
+
+		if (crossover == 0)
+			cout << endl << "the scan was faster at all sizes" << endl;
+		else
+			cout << endl << "the index is faster from " << crossover << " children" << endl;
+	};
+};
+};
+};
+};
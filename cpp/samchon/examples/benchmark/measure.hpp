@@ -0,0 +1,42 @@
+#pragma once
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <functional>
+
+namespace samchon
+{
+namespace examples
+{
+namespace benchmark
+{
+	/**
+	 * Measure elapsed time of a repeated procedure.
+	 *
+	 * Calls the *procedure* *count* times and prints elapsed time and number of calls per second.
+	 *
+	 * @param title Title to print.
+	 * @param count Number of calls.
+	 * @param procedure A procedure to measure.
+	 * @return Elapsed time in milliseconds.
+	 */
+	inline auto measure(const std::string &title, size_t count, std::function<void()> procedure) -> double
+	{
+		auto first = std::chrono::high_resolution_clock::now();
+		for (size_t i = 0; i < count; i++)
+			procedure();
+		auto last = std::chrono::high_resolution_clock::now();
+
+		double elapsed = std::chrono::duration<double, std::milli>(last - first).count();
+
+		std::cout << std::left << std::setw(40) << title
+			<< std::right << std::setw(12) << std::fixed << std::setprecision(2) << elapsed << " ms"
+			<< std::setw(14) << (size_t)(count / (elapsed / 1000.0)) << " /sec" << std::endl;
+
+		return elapsed;
+	};
+};
+};
+};
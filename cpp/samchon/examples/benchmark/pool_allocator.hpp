@@ -0,0 +1,120 @@
+#pragma once
+
+#include <iostream>
+#include <iomanip>
+#include <list>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <samchon/library/PoolAllocator.hpp>
+
+namespace samchon
+{
+namespace examples
+{
+namespace benchmark
+{
+namespace pool_allocator
+{
+	/**
+	 * An allocator locking a global mutex, like the former {@link library::CriticalAllocator}.
+	 */
+	template <class T>
+	class LockedAllocator
+		: public std::allocator<T>
+	{
+	public:
+		template <class U>
+		struct rebind
+		{
+			typedef LockedAllocator<U> other;
+		};
+
+		LockedAllocator() = default;
+
+		template <class U>
+		LockedAllocator(const LockedAllocator<U> &)
+		{
+		};
+
+		auto allocate(size_t n) -> T*
+		{
+			std::unique_lock<std::mutex> uk(mtx());
+			return std::allocator<T>::allocate(n);
+		};
+
+		void deallocate(T *ptr, size_t n)
+		{
+			std::unique_lock<std::mutex> uk(mtx());
+			std::allocator<T>::deallocate(ptr, n);
+		};
+
+		static auto mtx() -> std::mutex&
+		{
+			static std::mutex obj;
+			return obj;
+		};
+	};
+
+	/**
+	 * Each thread fills a list of its own and clears it, repeatedly.
+	 *
+	 * @return Number of allocations and deallocations per second, of all the threads.
+	 */
+	template <class Allocator>
+	auto throughput(size_t threads_size) -> size_t
+	{
+		const size_t NODES = 1000;
+		const size_t ROUNDS = 2000 / threads_size + 1;
+
+		auto first = std::chrono::high_resolution_clock::now();
+		{
+			std::vector<std::thread> threads;
+			for (size_t i = 0; i < threads_size; i++)
+				threads.emplace_back([&]()
+				{
+					std::list<size_t, Allocator> nodes;
+
+					for (size_t r = 0; r < ROUNDS; r++)
+					{
+						for (size_t n = 0; n < NODES; n++)
+							nodes.push_back(n);
+						nodes.clear();
+					}
+				});
+			for (size_t i = 0; i < threads.size(); i++)
+				threads[i].join();
+		}
+		auto last = std::chrono::high_resolution_clock::now();
+
+		double seconds = std::chrono::duration<double>(last - first).count();
+		return (size_t)(threads_size * ROUNDS * NODES * 2 / seconds);
+	};
+
+	/**
+	 * Allocation throughput of {@link library::PoolAllocator}, ```std::allocator``` and an allocator locking a
+	 * global mutex like the former {@link library::CriticalAllocator}, by 1, 4 and 16 threads.
+	 */
+	void main()
+	{
+		using namespace std;
+		using namespace samchon::library;
+
+		cout << "-------------------------------------------------------------" << endl;
+		cout << "	Allocations and deallocations per second" << endl;
+		cout << "-------------------------------------------------------------" << endl;
+
+		size_t sizes[] = { 1, 4, 16 };
+		for (size_t i = 0; i < 3; i++)
+			cout << left << setw(12) << (to_string(sizes[i]) + " threads")
+				<< "PoolAllocator: " << setw(12) << throughput<PoolAllocator<size_t>>(sizes[i])
+				<< "std: " << setw(12) << throughput<std::allocator<size_t>>(sizes[i])
+				<< "locked: " << throughput<LockedAllocator<size_t>>(sizes[i]) << " /sec" << endl;
+
+		cout << endl << "reserved by PoolArena: " << PoolArena::getReservedSize() / 1024 << " KB" << endl;
+	};
+};
+};
+};
+};
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <shared_mutex>
+#include <samchon/library/RWMutex.hpp>
+
+namespace samchon
+{
+namespace examples
+{
+namespace benchmark
+{
+namespace rw_mutex
+{
+	/**
+	 * Adaptors locking each mutex by the same interface.
+	 */
+	struct FrameworkMutex
+	{
+		library::RWMutex mtx;
+
+		FrameworkMutex(bool fair = false)
+			: mtx(fair)
+		{
+		};
+
+		void readLock() { mtx.readLock(); };
+		void readUnlock() { mtx.readUnlock(); };
+		void writeLock() { mtx.writeLock(); };
+		void writeUnlock() { mtx.writeUnlock(); };
+	};
+
+	struct StandardMutex
+	{
+		std::shared_mutex mtx;
+
+		void readLock() { mtx.lock_shared(); };
+		void readUnlock() { mtx.unlock_shared(); };
+		void writeLock() { mtx.lock(); };
+		void writeUnlock() { mtx.unlock(); };
+	};
+
+	/**
+	 * Lock and unlock by threads, one writing per *WRITE_RATIO* readings, for a second.
+	 *
+	 * @return Number of locks per second.
+	 */
+	template <class Mutex>
+	auto throughput(Mutex &mtx, size_t threads_size) -> size_t
+	{
+		const size_t WRITE_RATIO = 20;
+
+		std::atomic<bool> stopped(false);
+		std::atomic<size_t> count(0);
+		size_t value = 0;
+
+		std::vector<std::thread> threads;
+		for (size_t i = 0; i < threads_size; i++)
+			threads.emplace_back([&]()
+			{
+				size_t my_count = 0;
+				volatile size_t sum = 0;
+
+				while (stopped == false)
+				{
+					if (++my_count % WRITE_RATIO == 0)
+					{
+						mtx.writeLock();
+						value++;
+						mtx.writeUnlock();
+					}
+					else
+					{
+						mtx.readLock();
+						sum = sum + value;
+						mtx.readUnlock();
+					}
+				}
+				count += my_count;
+			});
+
+		std::this_thread::sleep_for(std::chrono::seconds(1));
+		stopped = true;
+
+		for (size_t i = 0; i < threads.size(); i++)
+			threads[i].join();
+
+		return count;
+	};
+
+	/**
+	 * Time for a writer to lock, while readers lock continuously and their sections overlap.
+	 *
+	 * Readers stop after a second, thus a starved writer locks in about 1,000 ms.
+	 *
+	 * @return Elapsed time in milliseconds.
+	 */
+	template <class Mutex>
+	auto writer_latency(Mutex &mtx, size_t readers_size) -> double
+	{
+		std::atomic<bool> stopped(false);
+		std::vector<std::thread> threads;
+
+		for (size_t i = 0; i < readers_size; i++)
+			threads.emplace_back([&]()
+			{
+				while (stopped == false)
+				{
+					mtx.readLock();
+					std::this_thread::sleep_for(std::chrono::microseconds(100));
+					mtx.readUnlock();
+				}
+			});
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+		// STOP READERS AFTER A SECOND, NOT TO WAIT FOREVER
+		std::thread timer([&stopped]()
+		{
+			std::this_thread::sleep_for(std::chrono::seconds(1));
+			stopped = true;
+		});
+
+		auto first = std::chrono::high_resolution_clock::now();
+		mtx.writeLock();
+		auto last = std::chrono::high_resolution_clock::now();
+		mtx.writeUnlock();
+
+		timer.join();
+		for (size_t i = 0; i < threads.size(); i++)
+			threads[i].join();
+
+		return std::chrono::duration<double, std::milli>(last - first).count();
+	};
+
+	/**
+	 * Contention of {@link library::RWMutex} and ```std::shared_mutex```.
+	 *
+	 * Prints locks per second of 1, 4 and 16 threads, reading mostly like {@link templates::service::Server} and
+	 * {@link templates::external::ExternalSystemArray}, and time for a writer to lock among 8 readers.
+	 */
+	void main()
+	{
+		using namespace std;
+
+		cout << "-------------------------------------------------------------" << endl;
+		cout << "	RWMutex and std::shared_mutex" << endl;
+		cout << "-------------------------------------------------------------" << endl;
+
+		size_t sizes[] = { 1, 4, 16 };
+		for (size_t i = 0; i < 3; i++)
+		{
+			FrameworkMutex preferred;
+			FrameworkMutex fair(true);
+			StandardMutex standard;
+
+			cout << left << setw(12) << (to_string(sizes[i]) + " threads")
+				<< "RWMutex: " << setw(12) << throughput(preferred, sizes[i])
+				<< "fair: " << setw(12) << throughput(fair, sizes[i])
+				<< "std: " << throughput(standard, sizes[i]) << " /sec" << endl;
+		}
+
+		FrameworkMutex preferred;
+		FrameworkMutex fair(true);
+		StandardMutex standard;
+
+		cout << endl << "writer among 8 readers - "
+			<< "RWMutex: " << writer_latency(preferred, 8) << " ms, "
+			<< "fair: " << writer_latency(fair, 8) << " ms, "
+			<< "std: " << writer_latency(standard, 8) << " ms" << endl;
+	};
+};
+};
+};
+};
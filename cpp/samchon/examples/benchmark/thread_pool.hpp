@@ -0,0 +1,85 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <samchon/library/ThreadPool.hpp>
+#include <samchon/examples/benchmark/measure.hpp>
+
+namespace samchon
+{
+namespace examples
+{
+namespace benchmark
+{
+namespace thread_pool
+{
+	/**
+	 * Fan-out to 500 recipients, by a thread per recipient and by {@link library::ThreadPool}.
+	 *
+	 * Like {@link templates::service::Server.sendData} broadcasting an {@link protocol::Invoke} message to 500
+	 * clients, a job is done for each recipient and the caller waits for all of them. Measured with an empty job and
+	 * with a job writing about 1 KB, then prints metrics of the pool.
+	 */
+	void main()
+	{
+		using namespace std;
+		using namespace samchon::library;
+
+		const size_t RECIPIENTS = 500;
+		const size_t REPEAT = 20;
+
+		vector<size_t> recipients(RECIPIENTS);
+		atomic<size_t> written(0);
+
+		auto job = [&written](size_t &)
+		{
+			char buffer[1024];
+			for (size_t i = 0; i < sizeof(buffer); i++)
+				buffer[i] = (char)i;
+
+			written += buffer[sizeof(buffer) - 1];
+		};
+
+		cout << "-------------------------------------------------------------" << endl;
+		cout << "	Fan-out to " << RECIPIENTS << " recipients, " << ThreadPool::shared().size() << " workers" << endl;
+		cout << "-------------------------------------------------------------" << endl;
+
+		measure("thread per recipient, empty", REPEAT, [&]()
+		{
+			vector<thread> threads;
+			threads.reserve(RECIPIENTS);
+			for (size_t i = 0; i < RECIPIENTS; i++)
+				threads.emplace_back([]() {});
+			for (size_t i = 0; i < threads.size(); i++)
+				threads[i].join();
+		});
+		measure("thread pool, empty", REPEAT, [&]()
+		{
+			ThreadPool::shared().forEach(recipients.begin(), recipients.end(), [](size_t &) {});
+		});
+
+		measure("thread per recipient, 1 KB", REPEAT, [&]()
+		{
+			vector<thread> threads;
+			threads.reserve(RECIPIENTS);
+			for (size_t i = 0; i < RECIPIENTS; i++)
+				threads.emplace_back(job, ref(recipients[i]));
+			for (size_t i = 0; i < threads.size(); i++)
+				threads[i].join();
+		});
+		measure("thread pool, 1 KB", REPEAT, [&]()
+		{
+			ThreadPool::shared().forEach(recipients.begin(), recipients.end(), job);
+		});
+
+		ThreadPool &pool = ThreadPool::shared();
+		cout << endl << "completed tasks: " << pool.getCompletedCount()
+			<< ", average latency: " << pool.getAverageLatency() << " ms"
+			<< ", max latency: " << pool.getMaxLatency() << " ms" << endl;
+	};
+};
+};
+};
+};
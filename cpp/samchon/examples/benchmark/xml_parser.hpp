@@ -0,0 +1,324 @@
+#pragma once
+
+#include <iostream>
+#include <iomanip>
+#include <queue>
+#include <samchon/library/XML.hpp>
+#include <samchon/library/XMLDocument.hpp>
+#include <samchon/library/XMLReader.hpp>
+#include <samchon/protocol/Invoke.hpp>
+#include <samchon/examples/tsp/Travel.hpp>
+#include <samchon/examples/benchmark/measure.hpp>
+
+namespace samchon
+{
+namespace examples
+{
+namespace benchmark
+{
+namespace xml_parser
+{
+	/**
+	 * The former parser of {@link library::XML}, to be compared with.
+	 *
+	 * Comments are stripped by copying the string, and each element is parsed from its substring; the key and
+	 * properties by finding delimiters, the children by counting blocks character by character and parsing each
+	 * block again.
+	 */
+	class LegacyParser
+	{
+	public:
+		static auto parse(WeakString wstr) -> std::shared_ptr<library::XML>
+		{
+			std::shared_ptr<library::XML> xml(new library::XML());
+			if (wstr.find('<') == std::string::npos)
+				return xml;
+
+			// WHEN COMMENT IS
+			std::string replacedStr;
+			if (wstr.find("<!--") != std::string::npos)
+			{
+				std::queue<std::pair<size_t, size_t>> indexPairQueue;
+				size_t beginX = 0, endX;
+
+				replacedStr.reserve(wstr.size());
+				while ((beginX = wstr.find("<!--", beginX)) != std::string::npos)
+				{
+					indexPairQueue.push({ beginX, wstr.find("-->", beginX + 1) + 3 });
+					beginX++;
+				}
+
+				beginX = 0;
+				while (indexPairQueue.empty() == false)
+				{
+					endX = indexPairQueue.front().first;
+					replacedStr.append(wstr.substring(beginX, endX).str());
+
+					beginX = indexPairQueue.front().second;
+					indexPairQueue.pop();
+				}
+				replacedStr.append(wstr.substr(beginX).str());
+
+				wstr = replacedStr;
+			}
+
+			// ERASE HEADERS OF XML
+			if (wstr.find("<?xml") != std::string::npos)
+				wstr = wstr.between("?>");
+
+			parse(*xml, wstr);
+			return xml;
+		};
+
+	private:
+		static void parse(library::XML &xml, WeakString &wstr)
+		{
+			parse_key(xml, wstr);
+			parse_properties(xml, wstr);
+
+			if (parse_value(xml, wstr) == true)
+				parse_children(xml, wstr);
+		};
+
+		static void parse_key(library::XML &xml, WeakString &wstr)
+		{
+			size_t startX = wstr.find("<") + 1;
+			size_t endX = calc_min_index
+			({
+				wstr.find(' ', startX),
+				wstr.find("\r\n", startX),
+				wstr.find('\n', startX),
+				wstr.find('\t', startX),
+				wstr.find('>', startX),
+				wstr.find('/', startX)
+			});
+
+			xml.setTag(wstr.substring(startX, endX).str());
+		};
+
+		static void parse_properties(library::XML &xml, WeakString &wstr)
+		{
+			struct QuotePair
+			{
+				char type;
+				size_t start_index;
+				size_t end_index;
+			};
+
+			const std::string &tag = xml.getTag();
+			size_t i_begin = wstr.find('<' + tag) + tag.size() + 1;
+			size_t i_end = calc_min_index({ wstr.rfind('/'), wstr.find('>', i_begin) });
+
+			if (i_end == std::string::npos || i_begin >= i_end)
+				return;
+
+			WeakString line = wstr.substring(i_begin, i_end);
+			if (line.find('=') == std::string::npos)
+				return;
+
+			std::vector<QuotePair*> helpers;
+			bool inQuote = false;
+			char type = 0;
+			size_t startPoint = 0;
+
+			for (size_t i = 0; i < line.size(); i++)
+				if (inQuote == false && (line[i] == '\'' || line[i] == '"'))
+				{
+					inQuote = true;
+					startPoint = i;
+					type = line[i];
+				}
+				else if (inQuote == true && line[i] == type)
+				{
+					helpers.push_back(new QuotePair({ type, startPoint, i }));
+					inQuote = false;
+				}
+
+			for (size_t i = 0; i < helpers.size(); i++)
+			{
+				size_t equalPoint;
+				std::string label;
+
+				if (i == 0)
+				{
+					equalPoint = line.find('=');
+					label = line.substring(0, equalPoint).trim().str();
+				}
+				else
+				{
+					equalPoint = line.find('=', helpers[i - 1]->end_index + 1);
+					label = line.substring(helpers[i - 1]->end_index + 1, equalPoint).trim().str();
+				}
+
+				static const std::vector<std::pair<std::string, std::string>> pairArray =
+				{
+					{ "&amp;", "&" },
+					{ "&lt;", "<" },
+					{ "&gt;", ">" },
+					{ "&quot;", "\"" },
+					{ "&apos;", "'" },
+					{ "&#x9;", "\t" },
+					{ "&#xA;", "\n" },
+					{ "&#xD;", "\r" }
+				};
+				std::string value = line.substring(helpers[i]->start_index + 1, helpers[i]->end_index).replaceAll(pairArray);
+				xml.setProperty(label, value);
+			}
+			for (size_t i = 0; i < helpers.size(); i++)
+				delete helpers[i];
+		};
+
+		static auto parse_value(library::XML &xml, WeakString &wstr) -> bool
+		{
+			size_t i_endSlash = wstr.rfind('/');
+			size_t i_endBlock = wstr.find('>');
+
+			if (i_endSlash < i_endBlock || i_endBlock + 1 == wstr.rfind('<'))
+			{
+				xml.setValue("");
+				return false;
+			}
+
+			wstr = wstr.substring(i_endBlock + 1, wstr.rfind('<'));
+
+			if (wstr.find('<') == std::string::npos)
+				xml.setValue(wstr.trim());
+			else
+				xml.setValue("");
+
+			return true;
+		};
+
+		static void parse_children(library::XML &xml, WeakString &wstr)
+		{
+			if (wstr.find('<') == std::string::npos)
+				return;
+
+			wstr = wstr.substring(wstr.find('<'), wstr.rfind('>') + 1);
+
+			int blockStartCount = 0;
+			int blockEndCount = 0;
+			size_t start = 0;
+
+			for (size_t i = 0; i < wstr.size(); i++)
+			{
+				if (wstr[i] == '<' && wstr.substr(i, 2) != "</")
+					blockStartCount++;
+				else if (wstr.substr(i, 2) == "/>" || wstr.substr(i, 2) == "</")
+					blockEndCount++;
+
+				if (blockStartCount >= 1 && blockStartCount == blockEndCount)
+				{
+					size_t end = wstr.find('>', i);
+
+					std::shared_ptr<library::XML> child(new library::XML());
+					WeakString block = wstr.substring(start, end + 1);
+					parse(*child, block);
+
+					xml.push_back(child);
+
+					i = end;
+					start = end + 1;
+					blockStartCount = 0;
+					blockEndCount = 0;
+				}
+			}
+
+			if (xml.size() > 0)
+				xml.setValue("");
+		};
+
+		static auto calc_min_index(const std::vector<size_t> &vec) -> size_t
+		{
+			size_t val = std::string::npos;
+			for (size_t i = 0; i < vec.size(); i++)
+				if (vec[i] != std::string::npos && vec[i] < val)
+					val = vec[i];
+
+			return val;
+		};
+	};
+
+	/**
+	 * Throughput of parsing XML.
+	 *
+	 * Parses {@link Invoke} messages carrying a {@link tsp::Travel} of points, like the TSP example sends, by the
+	 * single-pass parser of {@link library::XML}, into an arena by {@link library::XMLDocument} and by the 
+	 * {@link LegacyParser former parser}. Constructing the {@link tsp::Travel} from an {@link library::XML} object is 
+	 * compared with constructing it by an {@link library::XMLReader}, too. Prints MB/s of each. The former parser is
+	 * superlinear, thus it's skipped for the largest message.
+	 */
+	void main()
+	{
+		using namespace std;
+		using namespace samchon::library;
+		using namespace samchon::protocol;
+		using namespace samchon::examples::tsp;
+
+		cout << "-------------------------------------------------------------" << endl;
+		cout << "	Throughput of XML parsers" << endl;
+		cout << "-------------------------------------------------------------" << endl;
+
+		for (size_t count = 100; count <= 100 * 1000; count *= 10)
+		{
+			// A TRAVEL OF RANDOM POINTS
+			Travel travel;
+			for (size_t i = 0; i < count; i++)
+				travel.emplace_back(new GeometryPoint((int)i + 1, Math::random() * 360 - 180, Math::random() * 180 - 90));
+
+			shared_ptr<Invoke> invoke(new Invoke("setTravel", travel.toXML()));
+			string str = invoke->toXML()->toString();
+
+			double mb = str.size() / 1024.0 / 1024.0;
+			size_t repeat = max<size_t>(1, (size_t)(10 / mb));
+
+			cout << endl << count << " points, " << fixed << setprecision(2) << mb << " MB" << endl;
+
+			double elapsed = measure("single-pass", repeat, [&]()
+			{
+				XML xml(str);
+			});
+			cout << "single-pass: " << (mb * repeat) / (elapsed / 1000.0) << " MB/s" << endl;
+
+			elapsed = measure("document", repeat, [&]()
+			{
+				XMLDocument document(str);
+			});
+			cout << "document: " << (mb * repeat) / (elapsed / 1000.0) << " MB/s" << endl;
+
+			// CONSTRUCTING THE TRAVEL, FROM THE PARAMETER
+			string value;
+			travel.toXML()->write(value, true);
+
+			elapsed = measure("construct by XML", repeat, [&]()
+			{
+				Travel constructed;
+				constructed.construct(make_shared<XML>(value));
+			});
+			cout << "construct by XML: " << (mb * repeat) / (elapsed / 1000.0) << " MB/s" << endl;
+
+			elapsed = measure("construct by reader", repeat, [&]()
+			{
+				Travel constructed;
+				XMLReader reader(value);
+				reader.read();
+
+				EntityBase *entity = &constructed;
+				entity->construct(reader);
+			});
+			cout << "construct by reader: " << (mb * repeat) / (elapsed / 1000.0) << " MB/s" << endl;
+
+			if (count > 10 * 1000)
+				continue;
+
+			elapsed = measure("legacy", repeat, [&]()
+			{
+				shared_ptr<XML> xml = LegacyParser::parse(str);
+			});
+			cout << "legacy: " << (mb * repeat) / (elapsed / 1000.0) << " MB/s" << endl;
+		}
+	};
+};
+};
+};
+};
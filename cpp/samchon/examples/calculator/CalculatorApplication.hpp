@@ -7,6 +7,7 @@
 
 #include <samchon/library/StringUtil.hpp>
 #include <samchon/protocol/ServerConnector.hpp>
+#include <samchon/protocol/InvokeDispatcher.hpp>
 
 namespace samchon
 {
@@ -41,21 +42,15 @@ namespace calculator
 
 		virtual void replyData(std::shared_ptr<protocol::Invoke> invoke) override
 		{
-			std::function<void(double, double, double)> listener;
-			double x = invoke->at(0)->getValue<double>();
-			double y = invoke->at(1)->getValue<double>();;
-			double ret = invoke->at(2)->getValue<double>();
+			static const protocol::InvokeDispatcher<CalculatorApplication> dispatcher
+			({
+				{ "printPlus", &CalculatorApplication::printPlus },
+				{ "printMinus", &CalculatorApplication::printMinus },
+				{ "printMultiply", &CalculatorApplication::printMultiply },
+				{ "printDivide", &CalculatorApplication::printDivide }
+			});
 
-			if (invoke->getListener() == "printPlus")
-				listener = std::bind(&CalculatorApplication::printPlus, this);
-			else if (invoke->getListener() == "printMinus")
-				listener = std::bind(&CalculatorApplication::printMinus, this);
-			else if (invoke->getListener() == "printMultiply")
-				listener = std::bind(&CalculatorApplication::printMultiply, this);
-			else if (invoke->getListener() == "printDivide")
-				listener = std::bind(&CalculatorApplication::printDivide, this);
-
-			listener(x, y, ret);
+			dispatcher.dispatch(this, invoke);
 		};
 
 	private:
@@ -1,5 +1,6 @@
 #pragma once
 #include <samchon/protocol/Server.hpp>
+#include <samchon/protocol/InvokeDispatcher.hpp>
 
 #include <unordered_set>
 #include <samchon/library/RWMutex.hpp>
@@ -40,21 +41,13 @@ namespace calculator
 		};
 		virtual void replyData(std::shared_ptr<protocol::Invoke> invoke) override
 		{
-			if (invoke->getListener() == "computePlus")
-			{
-				double x = invoke->front()->getValue<double>();
-				double y = invoke->front()->getValue<double>();
-
-				computePlus(x, y);
-			}
-			else if (invoke->getListener() == "computeMinus")
-			{
-				double x = invoke->front()->getValue<double>();
-				double y = invoke->front()->getValue<double>();
+			static const protocol::InvokeDispatcher<CalculatorClient> dispatcher
+			({
+				{ "computePlus", &CalculatorClient::computePlus },
+				{ "computeMinus", &CalculatorClient::computeMinus }
+			});
 
-				computeMinus(x, y);
-			}
-			else
+			if (dispatcher.dispatch(this, invoke) == false)
 				((protocol::IProtocol*)server)->replyData(invoke);
 		};
 
@@ -100,12 +93,15 @@ namespace calculator
 			}
 			uk.unlock();
 			
+			// WHEN DISCONNECTED, ERASE CLIENT OBJECT FROM THE SET CONTAINER
+			driver->onClose = [this, client]()
+			{
+				library::UniqueWriteLock uk(mtx);
+				clients.erase(client);
+			};
+
 			// LISTEN FROM THE CLIENT
 			driver->listen(client.get());
-			
-			// WHEN DISCONNECTED, ERASE CLIENT OBJECT FROM THE SET CONTAINER
-			uk.lock();
-			clients.erase(client);
 		};
 
 	public:
@@ -128,20 +124,13 @@ namespace calculator
 		};
 		virtual void replyData(std::shared_ptr<protocol::Invoke> invoke)
 		{
-			if (invoke->getListener() == "computeMultiply")
-			{
-				double x = invoke->front()->getValue<double>();
-				double y = invoke->front()->getValue<double>();
+			static const protocol::InvokeDispatcher<CalculatorServer> dispatcher
+			({
+				{ "computeMultiply", &CalculatorServer::computeMultiply },
+				{ "computeDivide", &CalculatorServer::computeDivide }
+			});
 
-				computeMultiply(x, y);
-			}
-			else if (invoke->getListener() == "computeDivide")
-			{
-				double x = invoke->front()->getValue<double>();
-				double y = invoke->front()->getValue<double>();
-
-				computeDivide(x, y);
-			}
+			dispatcher.dispatch(this, invoke);
 		};
 
 	private:
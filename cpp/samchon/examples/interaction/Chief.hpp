@@ -5,6 +5,7 @@
 
 #include <samchon/examples/interaction/TSPProcess.hpp>
 #include <samchon/examples/interaction/PackerProcess.hpp>
+#include <samchon/protocol/InvokeDispatcher.hpp>
 
 namespace samchon
 {
@@ -71,8 +72,12 @@ namespace interaction
 
 		virtual void replyData(std::shared_ptr<protocol::Invoke> invoke) override
 		{
-			if (invoke->getListener() == "set_uid")
-				set_uid(invoke->front()->getValue<size_t>());
+			static const protocol::InvokeDispatcher<Chief> dispatcher
+			({
+				{ "set_uid", &Chief::set_uid }
+			});
+
+			dispatcher.dispatch(this, invoke);
 		};
 
 	private:
@@ -7,6 +7,7 @@
 #include <samchon/examples/interaction/ChiefDriver.hpp>
 #include <samchon/examples/interaction/TSPRequest.hpp>
 #include <samchon/examples/interaction/PackerRequest.hpp>
+#include <samchon/protocol/InvokeDispatcher.hpp>
 
 namespace samchon
 {
@@ -82,8 +83,12 @@ namespace interaction
 
 		virtual void replyData(std::shared_ptr<protocol::Invoke> invoke)
 		{
-			if (invoke->getListener() == "set_uid")
-				set_uid(invoke->front()->getValue<int>());
+			static const protocol::InvokeDispatcher<Master> dispatcher
+			({
+				{ "set_uid", &Master::set_uid }
+			});
+
+			dispatcher.dispatch(this, invoke);
 		};
 
 	private:
@@ -43,12 +43,14 @@ namespace interaction
 		virtual void addClient(std::shared_ptr<protocol::ClientDriver> driver) override
 		{
 			int uid = ++sequence;
-			std::unique_ptr<System> system(new System(this, driver, uid));
+			std::shared_ptr<System> system(new System(this, driver, uid));
 
 			system_map.emplace(uid, system.get());
+			driver->onClose = [this, uid, system]()
+			{
+				system_map.erase(uid);
+			};
 			driver->listen(system.get());
-
-			system_map.erase(uid);
 		};
 
 	public:
@@ -4,6 +4,7 @@
 
 #include <iostream>
 #include <samchon/examples/packer/Packer.hpp>
+#include <samchon/protocol/InvokeDispatcher.hpp>
 
 namespace samchon
 {
@@ -57,8 +58,12 @@ namespace interaction
 
 		virtual void replyData(std::shared_ptr<protocol::Invoke> invoke) override
 		{
-			if (invoke->getListener() == "replyOptimization")
-				printSolution(invoke->front()->getValueAsXML());
+			static const protocol::InvokeDispatcher<PackerProcess> dispatcher
+			({
+				{ "replyOptimization", &PackerProcess::printSolution }
+			});
+
+			dispatcher.dispatch(this, invoke);
 		};
 
 	private:
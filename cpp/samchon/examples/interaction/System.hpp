@@ -4,6 +4,7 @@
 #include <samchon/examples/interaction/base/SystemBase.hpp>
 
 #include <samchon/protocol/ClientDriver.hpp>
+#include <samchon/protocol/InvokeDispatcher.hpp>
 #include <samchon/examples/interaction/base/ReporterBase.hpp>
 #include <samchon/examples/interaction/base/MonitorBase.hpp>
 
@@ -122,34 +123,42 @@ namespace interaction
 
 		virtual void replyData(std::shared_ptr<protocol::Invoke> invoke) override
 		{
-			if (invoke->getListener() == "construct")
-			{
-				construct(invoke->front()->getValueAsXML());
-				((base::MonitorBase*)monitor)->constructSystemTree();
+			static const protocol::InvokeDispatcher<System> dispatcher
+			({
+				{ "construct", &System::construct_tree },
+				{ "reportSendData", &System::reportSendData }
+			});
+
+			// THE CONSTRUCTION PRINTS THE WHOLE TREE INSTEAD
+			if (dispatcher.dispatch(this, invoke) == true && invoke->getListener() == "construct")
+				return;
 
-				// LET VIEWERS TO SEND SYSTEM STRUCTURE
-				Reporter *reporter = ((base::MonitorBase*)monitor)->getReporter();
-				((base::ReporterBase*)reporter)->sendSystems();
+			std::cout << invoke->toXML()->toString() << std::endl;
+		};
 
-				System *root = ((base::MonitorBase*)monitor)->getRootSystem();
-				std::cout << root->toXML()->toString() << std::endl;
+	private:
+		void construct_tree(std::shared_ptr<library::XML> xml)
+		{
+			construct(xml);
+			((base::MonitorBase*)monitor)->constructSystemTree();
 
-				return;
-			}
-			else if (invoke->getListener() == "reportSendData")
-			{
-				std::string listener = invoke->at(0)->getValue<std::string>();
-				int to = invoke->at(1)->getValue<int>();
-				int from = invoke->at(2)->getValue<int>();
+			// LET VIEWERS TO SEND SYSTEM STRUCTURE
+			Reporter *reporter = ((base::MonitorBase*)monitor)->getReporter();
+			((base::ReporterBase*)reporter)->sendSystems();
 
-				Reporter *reporter = ((base::MonitorBase*)monitor)->getReporter();
-				auto invoke = std::make_shared<protocol::Invoke>("printSendData", listener, from, to);
+			System *root = ((base::MonitorBase*)monitor)->getRootSystem();
+			std::cout << root->toXML()->toString() << std::endl;
+		};
 
-				((protocol::IProtocol*)reporter)->sendData(invoke);
-			}
-			std::cout << invoke->toXML()->toString() << std::endl;
+		void reportSendData(const std::string &listener, int to, int from)
+		{
+			Reporter *reporter = ((base::MonitorBase*)monitor)->getReporter();
+			auto invoke = std::make_shared<protocol::Invoke>("printSendData", listener, from, to);
+
+			((protocol::IProtocol*)reporter)->sendData(invoke);
 		};
 
+	public:
 		/* ---------------------------------------------------------
 			EXPORTERS
 		--------------------------------------------------------- */
@@ -84,12 +84,20 @@ namespace packer
 
 		virtual ~Instance() = default;
 
-		virtual void construct(shared_ptr<XML> xml) override
+		virtual void construct(XMLReader &reader) override
 		{
-			this->name = xml->getProperty("name");
-			this->price = xml->getProperty<int>("price");
-			this->volume = xml->getProperty<int>("volume");
-			this->weight = xml->getProperty<int>("weight");
+			EntityArchive archive(reader);
+			this->archive(archive);
+
+			reader.skip();
+		};
+
+		virtual void archive(EntityArchive &archive) override
+		{
+			archive.field("name", name);
+			archive.field("price", price);
+			archive.field("volume", volume);
+			archive.field("weight", weight);
 		};
 
 		/* ---------------------------------------------------------
@@ -130,17 +138,6 @@ namespace packer
 		/* ---------------------------------------------------------
 			EXPORT
 		--------------------------------------------------------- */
-		virtual auto toXML() const -> shared_ptr<XML> override
-		{
-			shared_ptr<XML> &xml = super::toXML();
-			xml->setProperty("name", name);
-			xml->setProperty("price", price);
-			xml->setProperty("volume", volume);
-			xml->setProperty("weight", weight);
-
-			return xml;
-		};
-
 		/**
 		 * @brief Return a string represents the Instance
 		 */
@@ -93,11 +93,39 @@ namespace packer
 			productArray->construct(xml->get(productArray->TAG())->at(0));
 		};
 
+		virtual void construct(XMLReader &reader) override
+		{
+			productArray->clear();
+
+			// THE PRODUCT_ARRAY AND WRAPPER_ARRAYS, AS THEY'RE READ
+			constructElements(reader);
+		};
+
+		virtual void construct(const ByteArray &data) override
+		{
+			super::construct(data);
+
+			EntityBase *base = productArray.get();
+			base->construct(data);
+		};
+
 	protected:
 		virtual auto createChild(shared_ptr<XML>) -> WrapperArray* override
 		{
 			return new WrapperArray();
 		};
+		virtual auto createChild(XMLReader &) -> WrapperArray* override
+		{
+			return new WrapperArray();
+		};
+
+		virtual void constructElement(XMLReader &reader) override
+		{
+			if (reader.getTag() == productArray->TAG())
+				productArray->construct(reader);
+			else
+				super::constructElement(reader);
+		};
 
 	public:
 		/* ---------------------------------------------------------
@@ -197,6 +225,12 @@ namespace packer
 			return xml;
 		};
 
+		virtual void writeByteArray(ByteArray &data) const override
+		{
+			super::writeByteArray(data);
+			productArray->writeByteArray(data);
+		};
+
 		/**
 		 * @brief Return a string represents an packaging method.
 		 */
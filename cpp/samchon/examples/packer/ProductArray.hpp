@@ -32,11 +32,21 @@ namespace packer
 		using super::super;
 		virtual ~ProductArray() = default;
 
+		virtual void construct(XMLReader &reader) override
+		{
+			// PRODUCTS ONE BY ONE, AS THEY'RE READ
+			constructElements(reader);
+		};
+
 	protected:
 		virtual auto createChild(shared_ptr<XML>) -> Product* override
 		{
 			return new Product();
 		};
+		virtual auto createChild(XMLReader &) -> Product* override
+		{
+			return new Product();
+		};
 
 	public:
 		/* ---------------------------------------------------------
@@ -71,10 +71,10 @@ namespace packer
 
 		virtual ~Wrapper() = default;
 
-		virtual void construct(shared_ptr<XML> xml) override
+		virtual void construct(XMLReader &reader) override
 		{
-			super::construct(xml);
-			Instance::construct(xml);
+			// FIELDS OF THE INSTANCE ARE ARCHIVED ON THE END TAG
+			super::construct(reader);
 		};
 
 	public:
@@ -117,14 +117,6 @@ namespace packer
 			return "wrapper";
 		};
 
-		virtual auto toXML() const -> shared_ptr<XML> override
-		{
-			shared_ptr<XML> &xml = super::toXML();
-			xml->insertAllProperties(Instance::toXML());
-
-			return xml;
-		};
-
 		/**
 		 * @brief Return a string represent the wrapper.
 		 * @details Returns a string of the Wrapper and Product(s) packaged in.
@@ -92,11 +92,16 @@ namespace packer
 
 		virtual ~WrapperArray() = default;
 
-		virtual void construct(shared_ptr<XML> xml) override
+		virtual void archive(EntityArchive &archive) override
 		{
-			super::construct(xml);
+			// FIELDS OF THE SAMPLE, AS FIELDS OF THE WRAPPER_ARRAY
+			sample->archive(archive);
+		};
 
-			sample->construct(xml);
+		virtual void construct(XMLReader &reader) override
+		{
+			// WRAPPERS ONE BY ONE, AS THEY'RE READ
+			constructElements(reader);
 		};
 
 	protected:
@@ -104,6 +109,10 @@ namespace packer
 		{
 			return new Wrapper();
 		};
+		virtual auto createChild(XMLReader &) -> Wrapper* override
+		{
+			return new Wrapper();
+		};
 
 	public:
 		/**
@@ -206,14 +215,6 @@ namespace packer
 			return "wrapper";
 		};
 
-		virtual auto toXML() const -> shared_ptr<XML> override
-		{
-			shared_ptr<XML> &xml = super::toXML();
-			xml->insertAllProperties(sample->toXML());
-
-			return xml;
-		};
-
 		/**
 		 * @brief Return a string represents Wrapper(s) of same type
 		 */
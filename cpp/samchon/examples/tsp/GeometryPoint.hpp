@@ -93,11 +93,19 @@ namespace tsp
 
 		virtual ~GeometryPoint() = default;
 
-		virtual void construct(shared_ptr<XML> xml) override
+		virtual void construct(XMLReader &reader) override
 		{
-			uid = xml->getProperty<int>("uid");
-			longitude = xml->getProperty<double>("longitude");
-			latitude = xml->getProperty<double>("latitude");
+			EntityArchive archive(reader);
+			this->archive(archive);
+
+			reader.skip();
+		};
+
+		virtual void archive(EntityArchive &archive) override
+		{
+			archive.field("uid", uid);
+			archive.field("longitude", longitude);
+			archive.field("latitude", latitude);
 		};
 
 		/* -----------------------------------------------------------
@@ -143,16 +151,6 @@ namespace tsp
 			return "point";
 		};
 
-		auto toXML() const -> shared_ptr<XML> override
-		{
-			shared_ptr<XML> &xml = super::toXML();
-			xml->setProperty("uid", uid);
-			xml->setProperty("longitude", longitude);
-			xml->setProperty("latitude", latitude);
-
-			return xml;
-		};
-
 		/**
 		 * @brief Convert the Branch to String
 		 *
@@ -87,11 +87,35 @@ namespace tsp
 				distance = INT_MIN;
 		};
 
+		virtual void construct(XMLReader &reader) override
+		{
+			// POINTS ONE BY ONE, AS THEY'RE READ
+			constructElements(reader);
+
+			// PROPERTIES ARE KEPT ON THE END TAG
+			if (reader.hasProperty("distance") == true)
+				distance = reader.getProperty<double>("distance");
+			else
+				distance = INT_MIN;
+		};
+
+		virtual void construct(const ByteArray &data) override
+		{
+			super::construct(data);
+
+			// DISTANCE IS NOT ARCHIVED, BUT CALCULATED AGAIN
+			distance = INT_MIN;
+		};
+
 	protected:
 		virtual auto createChild(shared_ptr<XML>) -> GeometryPoint*
 		{
 			return new GeometryPoint();
 		};
+		virtual auto createChild(XMLReader &) -> GeometryPoint* override
+		{
+			return new GeometryPoint();
+		};
 
 		/* -----------------------------------------------------------
 			CALCULATORS
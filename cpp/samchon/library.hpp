@@ -5,6 +5,7 @@
 /* -------------------------------------------------------------
 	CRITICAL SECTION
 ------------------------------------------------------------- */
+#include <samchon/library/PoolAllocator.hpp>
 #include <samchon/library/CriticalAllocator.hpp>
 #include <samchon/library/CriticalList.hpp>
 #include <samchon/library/CriticalVector.hpp>
@@ -0,0 +1,212 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <array>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <samchon/ByteArray.hpp>
+
+namespace samchon
+{
+namespace library
+{
+	/**
+	 * A pool of binary buffers.
+	 *
+	 * The {@link ByteArrayPool} recycles {@link ByteArray} buffers, which are used for receiving large binary data.
+	 * Buffers are classified by their sizes, power of 2, and a buffer {@link borrow borrowed} from the pool is given
+	 * back by {@link recycle recycle()} to be borrowed again.
+	 *
+	 * A borrowed buffer is not zero-filled. Its contents are garbage of previous usage, thus the buffer must be
+	 * overwritten, like reading from a socket. Only the part exceeding the previous usage is filled by zero.
+	 *
+	 * Buffers smaller than {@link MIN_SIZE} are not pooled, because allocating them is cheap enough. Buffers larger
+	 * than {@link MAX_SIZE} are not pooled too, for memory not to be held too much.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class ByteArrayPool
+	{
+	public:
+		/**
+		 * Minimum size of buffers to be pooled, 4 KB.
+		 */
+		static const size_t MIN_SIZE = 1 << 12;
+
+		/**
+		 * Maximum size of buffers to be pooled, 256 MB.
+		 */
+		static const size_t MAX_SIZE = 1 << 28;
+
+	private:
+		static const size_t MIN_EXPONENT = 12;
+		static const size_t MAX_EXPONENT = 28;
+		static const size_t CLASS_COUNT = MAX_EXPONENT - MIN_EXPONENT + 1;
+
+		std::array<std::vector<ByteArray>, CLASS_COUNT> classes;
+		std::array<std::mutex, CLASS_COUNT> mutexes;
+
+		size_t capacity_;
+
+		std::atomic<size_t> hits_;
+		std::atomic<size_t> misses_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Constructor.
+		 *
+		 * @param capacity Maximum number of buffers kept for each size class.
+		 */
+		ByteArrayPool(size_t capacity = 8)
+		{
+			capacity_ = capacity;
+
+			hits_ = 0;
+			misses_ = 0;
+		};
+
+		/**
+		 * Get the default pool.
+		 *
+		 * The default pool is used by {@link protocol::Communicator} for receiving {@link ByteArray} parameters.
+		 *
+		 * @return The default pool.
+		 */
+		static auto getInstance() -> ByteArrayPool&
+		{
+			static ByteArrayPool pool;
+			return pool;
+		};
+
+		/* ---------------------------------------------------------
+			BORROW & RECYCLE
+		--------------------------------------------------------- */
+		/**
+		 * Borrow a buffer.
+		 *
+		 * @param size Size of the buffer.
+		 * @return A buffer whose size is the *size*, without zero-filled.
+		 */
+		auto borrow(size_t size) -> ByteArray
+		{
+			ByteArray data;
+
+			size_t index = class_index(size);
+			if (index != CLASS_COUNT)
+			{
+				std::unique_lock<std::mutex> uk(mutexes[index]);
+				std::vector<ByteArray> &buffers = classes[index];
+
+				if (buffers.empty() == false)
+				{
+					data = move(buffers.back());
+					buffers.pop_back();
+				}
+			}
+
+			if (data.capacity() == 0)
+			{
+				// ALLOCATE IN SIZE OF THE CLASS
+				misses_++;
+
+				if (index != CLASS_COUNT)
+					data.reserve((size_t)1 << (index + MIN_EXPONENT));
+			}
+			else
+				hits_++;
+
+			// SHRINKING DOESN'T FILL
+			data.resize(size);
+			return data;
+		};
+
+		/**
+		 * Give back a buffer.
+		 *
+		 * @param data A buffer to give back, which has been {@link borrow borrowed}.
+		 */
+		void recycle(ByteArray &&data)
+		{
+			// THE CLASS WHOSE SIZE IS LESS THAN OR EQUAL TO THE CAPACITY
+			size_t capacity = data.capacity();
+			if (capacity < MIN_SIZE || capacity > MAX_SIZE)
+				return;
+
+			size_t index = 0;
+			while (((size_t)1 << (index + MIN_EXPONENT + 1)) <= capacity && index + 1 < CLASS_COUNT)
+				index++;
+
+			std::unique_lock<std::mutex> uk(mutexes[index]);
+			std::vector<ByteArray> &buffers = classes[index];
+
+			if (buffers.size() < capacity_)
+				buffers.push_back(move(data));
+		};
+
+		/**
+		 * Release all the pooled buffers.
+		 */
+		void clear()
+		{
+			for (size_t i = 0; i < CLASS_COUNT; i++)
+			{
+				std::unique_lock<std::mutex> uk(mutexes[i]);
+				std::vector<ByteArray>().swap(classes[i]);
+			}
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Set maximum number of buffers kept for each size class.
+		 */
+		void setCapacity(size_t val)
+		{
+			capacity_ = val;
+		};
+
+		/**
+		 * Get maximum number of buffers kept for each size class.
+		 */
+		auto capacity() const -> size_t
+		{
+			return capacity_;
+		};
+
+		/**
+		 * Get number of borrowings served by pooled buffers.
+		 */
+		auto hits() const -> size_t
+		{
+			return hits_;
+		};
+
+		/**
+		 * Get number of borrowings which required allocation.
+		 */
+		auto misses() const -> size_t
+		{
+			return misses_;
+		};
+
+	private:
+		static auto class_index(size_t size) -> size_t
+		{
+			if (size < MIN_SIZE || size > MAX_SIZE)
+				return CLASS_COUNT;
+
+			// THE SMALLEST CLASS CAN CONTAIN THE SIZE
+			size_t index = 0;
+			while (((size_t)1 << (index + MIN_EXPONENT)) < size)
+				index++;
+
+			return index;
+		};
+	};
+};
+};
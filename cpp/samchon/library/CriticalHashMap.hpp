@@ -1,7 +1,7 @@
 #pragma once
 
 #include <samchon/HashMap.hpp>
-#include <samchon/library/CriticalAllocator.hpp>
+#include <samchon/library/PoolAllocator.hpp>
 
 namespace samchon
 {
@@ -10,11 +10,11 @@ namespace library
 	/**
 	 * @brief A TreeMap ensures concurrency.
 	 *
-	 * @see library::CriticalAllocator
+	 * @see library::PoolAllocator
 	 * @see samchon::library
 	 * @author Jeongho Nam <http://samchon.org>
 	 */
 	template <typename Key, typename T, typename _Pr = std::less<Key>>
-	using CriticalHashMap = HashMap<Key, T, std::hash<Key>, std::equal_to<Key>, CriticalAllocator<std::pair<const Key, T>>>;
+	using CriticalHashMap = HashMap<Key, T, std::hash<Key>, std::equal_to<Key>, PoolAllocator<std::pair<const Key, T>>>;
 };
 };
\ No newline at end of file
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <list>
-#include <samchon/library/CriticalAllocator.hpp>
+#include <samchon/library/PoolAllocator.hpp>
 
 namespace samchon
 {
@@ -10,11 +10,11 @@ namespace library
 	/**
 	 * @brief A std::list ensures concurrency.
 	 *
-	 * @see library::CriticalAllocator
+	 * @see library::PoolAllocator
 	 * @see samchon::library
 	 * @author Jeongho Nam <http://samchon.org>
 	 */
 	template <typename T>
-	using CriticalList = std::list<T, CriticalAllocator<T>>;
+	using CriticalList = std::list<T, PoolAllocator<T>>;
 };
 };
\ No newline at end of file
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <set>
-#include <samchon/library/CriticalAllocator.hpp>
+#include <samchon/library/PoolAllocator.hpp>
 
 namespace samchon
 {
@@ -10,11 +10,11 @@ namespace samchon
 		///**
 		// * @brief A Set ensures concurrency.
 		// *
-		// * @see library::CriticalAllocator
+		// * @see library::PoolAllocator
 		// * @see samchon::library
 		// * @author Jeongho Nam <http://samchon.org>
 		// */
 		template <typename T, typename _Pr = std::less<T>>
-		using CriticalSet = std::set<T, _Pr, CriticalAllocator<T>>;
+		using CriticalSet = std::set<T, _Pr, PoolAllocator<T>>;
 	};
 };
\ No newline at end of file
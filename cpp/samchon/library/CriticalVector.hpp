@@ -1,7 +1,7 @@
 #pragma once
 
 #include <vector>
-#include <samchon/library/CriticalAllocator.hpp>
+#include <samchon/library/PoolAllocator.hpp>
 
 namespace samchon
 {
@@ -10,11 +10,11 @@ namespace library
 	/**
 	 * @brief A std::vector ensures concurrency.
 	 *
-	 * @see library::CriticalAllocator
+	 * @see library::PoolAllocator
 	 * @see samchon::library
 	 * @author Jeongho Nam <http://samchon.org>
 	 */
 	template <typename T>
-	using CriticalVector = std::vector<T, CriticalAllocator<T>>;
+	using CriticalVector = std::vector<T, PoolAllocator<T>>;
 };
 };
\ No newline at end of file
@@ -1,16 +1,16 @@
 #pragma once
 #include <samchon/API.hpp>
 
-#include <queue>
-#include <unordered_set>
+#include <atomic>
 #include <unordered_map>
+#include <vector>
 
 #include <memory>
 #include <functional>
-#include <condition_variable>
 #include <mutex>
+#include <thread>
 
-#include <samchon/library/RWMutex.hpp>
+#include <samchon/library/ThreadPool.hpp>
 #include <samchon/library/Event.hpp>
 
 namespace samchon
@@ -23,11 +23,15 @@ namespace library
 	 * @details
 	 * <p> EventDispatcher is the base class for all classes that dispatch events. </p>
 	 *
-	 * <p> All the events are sent asynchronously. To avoid from creating tooo enourmouse threads
-	 * dispatching events, all event sending processes will acuiqre a semaphore. The default permitted
-	 * size of the semaphore is 2. </p>
-	 * 
-	 *	\li Number of thread pools used to sending events is 2.
+	 * <p> All the events are sent asynchronously. Each EventDispatcher has its own lock-free queue of
+	 * events, and the queue is drained by a {@link ThreadPool} of the EventDispatchers; by one worker at
+	 * a time. Thus events of an EventDispatcher are delivered in order of the dispatch, while events of
+	 * different EventDispatchers are delivered in parallel. </p>
+	 *
+	 *	\li Number of threads delivering events is THREAD_SIZE(); number of the hardware threads by default.
+	 *
+	 * <p> Listeners are kept in an immutable snapshot, which is replaced (copied on write) when a
+	 * listener is added or removed. Delivering an event reads the snapshot without any lock or copy. </p>
 	 *
 	 * <p> @image html  cpp/library_event.png
 	 *	   @image latex cpp/library_event.png </p>
@@ -50,19 +54,112 @@ namespace library
 	class EventDispatcher
 	{
 	public:
-		typedef void(*Listener)(std::shared_ptr<Event>, void*);
-		// typedef std::function<void(std::shared_ptr<Event>, void*)> Listener;
+		typedef std::function<void(std::shared_ptr<Event>, void*)> Listener;
 
 	private:
 		/**
-		 * @brief A container storing listeners
+		 * @brief A registered listener
 		 */
-		std::unordered_map<int, std::unordered_map<Listener, std::unordered_set<void*>>> listeners;
+		struct Entry
+		{
+			size_t id;
+			Listener listener;
+			void *addiction;
+		};
+		typedef std::unordered_map<int, std::shared_ptr<const std::vector<Entry>>> ListenerMap;
 
 		/**
-		 * @brief A rw_mutex for concurrency
+		 * @brief Queue of events to deliver, and listeners of an EventDispatcher
+		 *
+		 * @details
+		 * <p> Shared by the EventDispatcher and tasks delivering its events, thus a task does not refer a
+		 * destructed EventDispatcher. </p>
+		 *
+		 * <p> The queue is a linked list of multiple producers and a single consumer; dispatchers push by
+		 * an atomic exchange and the task holding the <i>scheduled</i> flag pops. </p>
 		 */
-		RWMutex mtx;
+		struct Channel
+		{
+			struct Node
+			{
+				std::atomic<Node*> next;
+				std::shared_ptr<Event> event;
+
+				Node()
+				{
+					next = nullptr;
+				};
+			};
+
+			// QUEUE
+			std::atomic<Node*> head;
+			Node *tail;
+			std::atomic<bool> scheduled;
+
+			// LISTENERS, COPIED ON WRITE
+			std::shared_ptr<const ListenerMap> listeners;
+			std::mutex listeners_mtx;
+			size_t sequence;
+
+			// DELIVERY
+			std::atomic<bool> closed;
+			std::mutex deliver_mtx;
+			std::atomic<std::thread::id> deliverer;
+
+			Channel()
+			{
+				tail = new Node();
+				head = tail;
+				scheduled = false;
+
+				listeners = std::make_shared<ListenerMap>();
+				sequence = 0;
+
+				closed = false;
+			};
+			~Channel()
+			{
+				while (tail != nullptr)
+				{
+					Node *next = tail->next;
+					delete tail;
+					tail = next;
+				}
+			};
+
+			void push(std::shared_ptr<Event> event)
+			{
+				Node *node = new Node();
+				node->event = std::move(event);
+
+				Node *prev = head.exchange(node);
+				prev->next = node;
+			};
+
+			auto pop() -> std::shared_ptr<Event>
+			{
+				Node *next = tail->next;
+				if (next == nullptr)
+					return nullptr;
+
+				// THE NEXT NODE BECOMES THE NEW STUB
+				std::shared_ptr<Event> event = std::move(next->event);
+				delete tail;
+				tail = next;
+
+				return event;
+			};
+
+			auto empty() const -> bool
+			{
+				return tail->next.load() == nullptr;
+			};
+		};
+
+		/**
+		 * @brief The channel of this EventDispatcher
+		 */
+		std::shared_ptr<Channel> channel;
 
 	public:
 		/* ----------------------------------------------------------
@@ -72,6 +169,7 @@ namespace library
 		 * @brief Default Constructor
 		 */
 		EventDispatcher()
+			: channel(std::make_shared<Channel>())
 		{
 		};
 
@@ -85,6 +183,7 @@ namespace library
 		 * @param eventDispatcher The object to copy
 		 */
 		EventDispatcher(const EventDispatcher &)
+			: channel(std::make_shared<Channel>())
 		{
 			// DO NOT COPY LISTENERS
 		};
@@ -92,41 +191,32 @@ namespace library
 		/**
 		 * @brief Move Constructor
 		 *
+		 * @details Listeners and events not delivered yet move along with the channel.
+		 *
 		 * @param eventDispatcher The object to move
 		 */
 		EventDispatcher(EventDispatcher &&obj)
+			: channel(std::move(obj.channel))
 		{
-			UniqueWriteLock obj_uk(obj.mtx);
-			{
-				listeners = move(obj.listeners);
-			}
-			obj_uk.unlock();
-
-			std::unique_lock<std::mutex> s_uk(sMtx());
-
-			for (auto it = eventMap().begin(); it != eventMap().end(); it++)
-				if (it->first == &obj)
-				{
-					auto event = it->second;
-
-					it = eventMap().erase(it);
-					eventMap().insert(it, { this, event });
-				}
+			obj.channel = std::make_shared<Channel>();
 		};
 
 		/**
 		 * @brief Default Destructor
+		 *
+		 * @details
+		 * <p> Events not delivered yet are discarded. If an event of this EventDispatcher is on delivery
+		 * by another thread, waits for the delivery to be done. </p>
 		 */
 		virtual ~EventDispatcher()
 		{
-			UniqueWriteLock my_uk(mtx);
-			std::unique_lock<std::mutex> s_uk(sMtx());
-
-			for (auto it = eventMap().begin(); it != eventMap().end();)
-				if (it->first == this)
-					eventMap().erase(it++);
-				else
-					it++;
+			channel->closed = true;
+
+			// A LISTENER MAY DESTRUCT ITS SOURCE; DON'T WAIT FOR ITSELF
+			if (channel->deliverer.load() != std::this_thread::get_id())
+			{
+				std::unique_lock<std::mutex> uk(channel->deliver_mtx);
+			}
 		};
 
 		/* ----------------------------------------------------------
@@ -150,12 +240,34 @@ namespace library
 		 * @param type The type of event.
 		 * @param listener The listener function processes the event.
 		 * @param addiction Something to be addicted following the listener.
+		 *
+		 * @return Identifier of the listener, to remove it. If the same function pointer has been registered
+		 *		   with the same addiction, identifier of the registered one.
 		 */
-		void addEventListener(int type, Listener listener, void *addiction = nullptr)
+		auto addEventListener(int type, Listener listener, void *addiction = nullptr) -> size_t
 		{
-			UniqueWriteLock uk(mtx);
+			std::unique_lock<std::mutex> uk(channel->listeners_mtx);
+			const ListenerMap &listeners = *channel->listeners;
+
+			// A FUNCTION POINTER IS REGISTERED ONCE FOR AN ADDICTION
+			auto it = listeners.find(type);
+			auto *pointer = listener.target<void(*)(std::shared_ptr<Event>, void*)>();
+
+			if (it != listeners.end() && pointer != nullptr)
+				for (const Entry &entry : *it->second)
+					if (equals(entry, *pointer, addiction) == true)
+						return entry.id;
 
-			listeners[type][listener].insert(addiction);
+			// COPY ON WRITE
+			std::shared_ptr<std::vector<Entry>> entries = (it == listeners.end())
+				? std::make_shared<std::vector<Entry>>()
+				: std::make_shared<std::vector<Entry>>(*it->second);
+
+			size_t id = ++channel->sequence;
+			entries->push_back({ id, std::move(listener), addiction });
+
+			replace(type, entries);
+			return id;
 		};
 
 		/**
@@ -169,27 +281,26 @@ namespace library
 		 * @param listener The listener function to remove.
 		 * @param addiction Somethhing to be addicted following the listener.
 		 */
-		void removeEventListener(int type, Listener listener, void *addiction = nullptr)
+		void removeEventListener(int type, void(*listener)(std::shared_ptr<Event>, void*), void *addiction = nullptr)
 		{
-			UniqueWriteLock uk(mtx);
-			if (listeners.count(type) == 0)
-				return;
-
-			// TEST WHETHER HAS THE LISTENER
-			if (listeners.count(type) == 0 ||
-				listeners[type].count(listener) == 0 ||
-				listeners[type][listener].count(addiction) == 0)
-				return;
-
-			listeners[type][listener].erase(addiction);
-
-			if (listeners[type][listener].empty() == true)
-				listeners[type].erase(listener);
-
-			if (listeners[type].empty() == true)
-				listeners.erase(type);
+			remove(type, [listener, addiction](const Entry &entry) -> bool
+			{
+				return equals(entry, listener, addiction);
+			});
+		};
 
-			// NEED TO DELETE FROM EVENT MAP
+		/**
+		 * @brief Remove a registered event listener by its identifier
+		 *
+		 * @param type The type of event.
+		 * @param id Identifier returned by addEventListener().
+		 */
+		void removeEventListener(int type, size_t id)
+		{
+			remove(type, [id](const Entry &entry) -> bool
+			{
+				return entry.id == id;
+			});
 		};
 
 		/**
@@ -199,124 +310,160 @@ namespace library
 		 * <p> Dispatches an event into the event flow in the background.
 		 * The Event::source is the EventDispatcher object upon which the dispatchEvent. </p>
 		 *
+		 * <p> Events of an EventDispatcher are delivered in order of the dispatch. </p>
+		 *
 		 * @param event The Event object that is dispatched into the event flow.
-		 * @return Whether there's some listener to listen the event
 		 */
 		void dispatch(std::shared_ptr<Event> event)
 		{
-			// STARTS BACK-GROUND PROCESS IF NOT STARTED
-			start();
-
-			UniqueReadLock my_uk(mtx);
-			if (listeners.count(event->getType()) == 0)
+			std::shared_ptr<const ListenerMap> listeners = std::atomic_load(&channel->listeners);
+			if (listeners->count(event->getType()) == 0)
 				return;
 
-			my_uk.unlock();
+			channel->push(std::move(event));
+			schedule(channel);
+		};
 
-			std::unique_lock<std::mutex> s_uk(sMtx());
-			eventMap().insert({ this, event });
+	private:
+		/* ----------------------------------------------------------
+			LISTENERS
+		---------------------------------------------------------- */
+		static auto equals(const Entry &entry, void(*listener)(std::shared_ptr<Event>, void*), void *addiction) -> bool
+		{
+			auto *pointer = entry.listener.target<void(*)(std::shared_ptr<Event>, void*)>();
 
-			cv().notify_all();
+			return pointer != nullptr && *pointer == listener && entry.addiction == addiction;
 		};
 
-	private:
-		void deliver(std::shared_ptr<Event> event)
+		template <class Predicate>
+		void remove(int type, Predicate pred)
 		{
-			UniqueReadLock my_uk(mtx);
-			if (listeners.count(event->getType()) == 0)
+			std::unique_lock<std::mutex> uk(channel->listeners_mtx);
+			const ListenerMap &listeners = *channel->listeners;
+
+			auto it = listeners.find(type);
+			if (it == listeners.end())
 				return;
 
-			auto listenerMap = listeners[event->getType()];
-			my_uk.unlock();
+			std::shared_ptr<std::vector<Entry>> entries = std::make_shared<std::vector<Entry>>();
+			for (const Entry &entry : *it->second)
+				if (pred(entry) == false)
+					entries->push_back(entry);
 
-			for (auto it = listenerMap.begin(); it != listenerMap.end(); it++)
-			{
-				Listener listener = it->first;
+			if (entries->size() != it->second->size())
+				replace(type, entries);
+		};
 
-				for (auto s_it = it->second.begin(); s_it != it->second.end(); s_it++)
-				{
-					void *addiction = *s_it;
+		/**
+		 * @brief Publishes a new snapshot of listeners
+		 * @details The listeners_mtx must be locked.
+		 */
+		void replace(int type, std::shared_ptr<const std::vector<Entry>> entries)
+		{
+			std::shared_ptr<ListenerMap> listeners = std::make_shared<ListenerMap>(*channel->listeners);
 
-					listener(event, addiction);
-				}
-			}
+			if (entries->empty() == true)
+				listeners->erase(type);
+			else
+				(*listeners)[type] = entries;
+
+			std::atomic_store(&channel->listeners, std::shared_ptr<const ListenerMap>(listeners));
 		};
 
 		/* ----------------------------------------------------------
-			MEMBERS OF STATIC
+			DELIVERY
 		---------------------------------------------------------- */
-		static bool& started()
-		{
-			static bool flag = false;
-			return flag;
-		};
-		static std::condition_variable& cv()
-		{
-			static std::condition_variable obj;
-			return obj;
-		};
-		static std::mutex& cv_mtx()
+		/**
+		 * @brief Submits a task draining the channel, unless one is already scheduled
+		 */
+		static void schedule(std::shared_ptr<Channel> channel)
 		{
-			static std::mutex obj;
-			return obj;
-		};
+			if (channel->scheduled.exchange(true) == true)
+				return;
 
-		static std::unordered_multimap<EventDispatcher*, std::shared_ptr<Event>>& eventMap()
-		{
-			static std::unordered_multimap<EventDispatcher*, std::shared_ptr<Event>> map;
-			return map;
+			pool().submit([channel]()
+			{
+				drain(channel);
+			});
 		};
 
-		static std::mutex& sMtx()
+		static void drain(std::shared_ptr<Channel> channel)
 		{
-			static std::mutex obj;
-			return obj;
-		};
+			// NOT TO OCCUPY A WORKER TOO LONG
+			const size_t BATCH_SIZE = 64;
 
-		static void start()
-		{
-			std::unique_lock<std::mutex> uk(sMtx());
-			if (started() == true)
-				return;
+			{
+				std::unique_lock<std::mutex> uk(channel->deliver_mtx);
+				channel->deliverer = std::this_thread::get_id();
 
-			started() = true;
-			uk.unlock();
+				for (size_t i = 0; i < BATCH_SIZE; i++)
+				{
+					std::shared_ptr<Event> event = channel->pop();
+					if (event == nullptr || channel->closed == true)
+						break;
 
-			for (size_t i = 0; i < THREAD_SIZE(); i++)
-				std::thread([]()
+					deliver(*channel, event);
+				}
+				channel->deliverer = std::thread::id();
+			}
+
+			if (channel->closed == true)
+				return;
+			else if (channel->empty() == false)
+			{
+				// LEFT EVENTS, IN TURN OF THE OTHER CHANNELS
+				pool().submit([channel]()
 				{
-					while (true)
-					{
-						while (true)
-						{
-							std::unique_lock<std::mutex> uk(sMtx());
-							if (eventMap().empty() == true)
-								break;
+					drain(channel);
+				});
+				return;
+			}
 
-							auto pair = *eventMap().begin();
-							eventMap().erase(eventMap().begin());
+			// AN EVENT MAY HAVE BEEN PUSHED AFTER THE CHECK, BY A DISPATCHER WHICH SAW THE FLAG
+			channel->scheduled = false;
+			if (channel->empty() == false)
+				schedule(channel);
+		};
 
-							uk.unlock();
+		static void deliver(Channel &channel, std::shared_ptr<Event> event)
+		{
+			std::shared_ptr<const ListenerMap> listeners = std::atomic_load(&channel.listeners);
 
-							EventDispatcher *obj = pair.first;
-							std::shared_ptr<Event> &event = pair.second;
+			auto it = listeners->find(event->getType());
+			if (it == listeners->end())
+				return;
 
-							obj->deliver(event);
-						}
+			// AN EXCEPTION OF A LISTENER DOES NOT STOP THE OTHERS, OR THE CHANNEL
+			for (const Entry &entry : *it->second)
+				try
+				{
+					entry.listener(event, entry.addiction);
+				}
+				catch (...)
+				{
+				}
+		};
 
-						std::unique_lock<std::mutex> cv_uk(cv_mtx());
-						cv().wait(cv_uk);
-					}
-				}).detach();
+		/* ----------------------------------------------------------
+			MEMBERS OF STATIC
+		---------------------------------------------------------- */
+		static ThreadPool& pool()
+		{
+			static ThreadPool obj(THREAD_SIZE());
+			return obj;
 		};
 
 	public:
 		/**
 		 * @brief Numer of threads for background.
+		 *
+		 * @details
+		 * Must be set before the first dispatch; the threads are created by the first dispatch. Zero means
+		 * number of the hardware threads.
 		 */
 		static size_t& THREAD_SIZE() 
 		{
-			static size_t val = 2;
+			static size_t val = 0;
 			return val;
 		};
 	};
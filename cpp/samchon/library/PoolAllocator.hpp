@@ -0,0 +1,436 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace samchon
+{
+namespace library
+{
+	/**
+	 * @brief Memory shared by PoolAllocator(s)
+	 *
+	 * @details
+	 * <p> Small blocks are classified by their sizes; 16, 32, 64, ... to 2,048 bytes. Each thread caches
+	 * free blocks of each class, thus allocating and deallocating by a thread cost only a few pointer
+	 * operations, without any lock. </p>
+	 *
+	 * <p> When a cache runs out of blocks, it takes a batch of blocks from the arena, shared by all the
+	 * threads; when a cache keeps too many blocks, it returns a batch to the arena. Only those batch
+	 * operations lock a mutex of the size class. The arena carves new blocks from chunks of 64 KB. </p>
+	 *
+	 * <p> Blocks larger than 2,048 bytes are allocated by <i>operator new</i> directly. As <i>operator new</i>
+	 * guarantees only 8 bytes alignment on 32 bits systems, those blocks and the chunks are over-allocated and
+	 * aligned by ALIGNMENT. </p>
+	 *
+	 * @note
+	 * <p> Memory of the chunks is reused by the threads, but never returned to the system. </p>
+	 *
+	 * @see library::PoolAllocator
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class PoolArena
+	{
+	public:
+		/**
+		 * @brief Alignment of the blocks
+		 */
+		static const size_t ALIGNMENT = 16;
+
+		/**
+		 * @brief Size of the largest class
+		 */
+		static const size_t MAX_SIZE = 2048;
+
+	private:
+		static const size_t CLASS_SIZE = 8;
+		static const size_t BATCH_SIZE = 32;
+		static const size_t CHUNK_SIZE = 64 * 1024;
+
+		struct Block
+		{
+			Block *next;
+		};
+
+		/**
+		 * @brief Free blocks of a size class, shared by the threads
+		 */
+		struct Bin
+		{
+			std::mutex mtx;
+			Block *blocks;
+
+			// THE CHUNK ON CARVING
+			char *first;
+			char *last;
+
+			Bin()
+			{
+				blocks = nullptr;
+				first = last = nullptr;
+			};
+		};
+
+		/**
+		 * @brief Free blocks cached by a thread
+		 */
+		class Cache
+		{
+		private:
+			Block *blocks_[CLASS_SIZE];
+			size_t counts_[CLASS_SIZE];
+
+		public:
+			Cache()
+			{
+				for (size_t i = 0; i < CLASS_SIZE; i++)
+				{
+					blocks_[i] = nullptr;
+					counts_[i] = 0;
+				}
+			};
+			~Cache()
+			{
+				// RETURN ALL TO THE ARENA, AND ALLOCATIONS AFTER THIS GO TO THE ARENA DIRECTLY
+				for (size_t i = 0; i < CLASS_SIZE; i++)
+					if (blocks_[i] != nullptr)
+						get().put(i, blocks_[i]);
+
+				exited() = true;
+			};
+
+			auto pop(size_t index) -> void*
+			{
+				if (blocks_[index] == nullptr)
+				{
+					blocks_[index] = get().take(index, BATCH_SIZE);
+					counts_[index] = BATCH_SIZE;
+				}
+
+				Block *block = blocks_[index];
+				blocks_[index] = block->next;
+				counts_[index]--;
+
+				return block;
+			};
+
+			void push(size_t index, void *ptr)
+			{
+				Block *block = (Block*)ptr;
+				block->next = blocks_[index];
+
+				blocks_[index] = block;
+
+				// KEEP A BATCH AND RETURN ANOTHER
+				if (++counts_[index] < BATCH_SIZE * 2)
+					return;
+
+				Block *last = blocks_[index];
+				for (size_t i = 1; i < BATCH_SIZE; i++)
+					last = last->next;
+
+				Block *returned = last->next;
+				last->next = nullptr;
+				counts_[index] = BATCH_SIZE;
+
+				get().put(index, returned);
+			};
+		};
+
+		Bin bins_[CLASS_SIZE];
+		std::mutex chunks_mtx_;
+		std::vector<void*> chunks_;
+
+	public:
+		/* ---------------------------------------------------------
+			ALLOCATION
+		--------------------------------------------------------- */
+		/**
+		 * @brief Allocate a block
+		 *
+		 * @param size Size of the block in bytes.
+		 * @return A block aligned by ALIGNMENT.
+		 * @throw std::bad_alloc When the system has run out of memory.
+		 */
+		static auto allocate(size_t size) -> void*
+		{
+			if (size > MAX_SIZE)
+				return allocate_aligned(size);
+
+			size_t index = index_of(size);
+			if (exited() == true)
+				return get().take(index, 1);
+
+			return cache().pop(index);
+		};
+
+		/**
+		 * @brief Deallocate a block
+		 *
+		 * @param ptr A block allocated by allocate(), by any thread.
+		 * @param size Size of the block in bytes, same with the allocate().
+		 */
+		static void deallocate(void *ptr, size_t size)
+		{
+			if (size > MAX_SIZE)
+			{
+				deallocate_aligned(ptr);
+				return;
+			}
+
+			size_t index = index_of(size);
+			if (exited() == true)
+			{
+				Block *block = (Block*)ptr;
+				block->next = nullptr;
+
+				get().put(index, block);
+			}
+			else
+				cache().push(index, ptr);
+		};
+
+		/**
+		 * @brief Get size of the memory reserved by the chunks, in bytes
+		 */
+		static auto getReservedSize() -> size_t
+		{
+			PoolArena &arena = get();
+			std::unique_lock<std::mutex> uk(arena.chunks_mtx_);
+
+			return arena.chunks_.size() * CHUNK_SIZE;
+		};
+
+	private:
+		/* ---------------------------------------------------------
+			INTERNAL
+		--------------------------------------------------------- */
+		static auto index_of(size_t size) -> size_t
+		{
+			size_t index = 0;
+			for (size_t capacity = ALIGNMENT; capacity < size; capacity <<= 1)
+				index++;
+
+			return index;
+		};
+
+		/**
+		 * @brief Take blocks linked as a list
+		 */
+		auto take(size_t index, size_t count) -> Block*
+		{
+			Bin &bin = bins_[index];
+			size_t size = ALIGNMENT << index;
+
+			std::unique_lock<std::mutex> uk(bin.mtx);
+			Block *first = nullptr;
+
+			for (size_t i = 0; i < count; i++)
+			{
+				Block *block;
+				if (bin.blocks != nullptr)
+				{
+					block = bin.blocks;
+					bin.blocks = block->next;
+				}
+				else
+				{
+					// CARVE A NEW BLOCK
+					if (bin.first == bin.last)
+					{
+						bin.first = (char*)reserve();
+						bin.last = bin.first + CHUNK_SIZE;
+					}
+					block = (Block*)bin.first;
+					bin.first += size;
+				}
+
+				block->next = first;
+				first = block;
+			}
+			return first;
+		};
+
+		/**
+		 * @brief Put back blocks linked as a list
+		 */
+		void put(size_t index, Block *blocks)
+		{
+			Block *last = blocks;
+			while (last->next != nullptr)
+				last = last->next;
+
+			Bin &bin = bins_[index];
+			std::unique_lock<std::mutex> uk(bin.mtx);
+
+			last->next = bin.blocks;
+			bin.blocks = blocks;
+		};
+
+		auto reserve() -> void*
+		{
+			// OVER-ALLOCATED TO BE ALIGNED, NEVER RELEASED
+			char *chunk = (char*)::operator new(CHUNK_SIZE + ALIGNMENT);
+
+			std::unique_lock<std::mutex> uk(chunks_mtx_);
+			chunks_.push_back(chunk);
+
+			return chunk + (ALIGNMENT - (uintptr_t)chunk % ALIGNMENT) % ALIGNMENT;
+		};
+
+		/**
+		 * @brief Allocate a large block aligned by ALIGNMENT
+		 *
+		 * @details
+		 * <p> Offset from the allocated memory is kept in the byte before the block. </p>
+		 */
+		static auto allocate_aligned(size_t size) -> void*
+		{
+			if (size > std::numeric_limits<size_t>::max() - ALIGNMENT)
+				throw std::bad_alloc();
+
+			unsigned char *memory = (unsigned char*)::operator new(size + ALIGNMENT);
+			unsigned char *block = memory + ALIGNMENT - (uintptr_t)memory % ALIGNMENT;
+
+			block[-1] = (unsigned char)(block - memory);
+			return block;
+		};
+
+		static void deallocate_aligned(void *ptr)
+		{
+			unsigned char *block = (unsigned char*)ptr;
+			::operator delete(block - block[-1]);
+		};
+
+		/* ---------------------------------------------------------
+			MEMBERS OF STATIC
+		--------------------------------------------------------- */
+		static auto get() -> PoolArena&
+		{
+			// NEVER DESTRUCTED; CACHES OF EXITING THREADS AND STATIC CONTAINERS MAY RETURN BLOCKS LATER
+			static PoolArena *obj = new PoolArena();
+			return *obj;
+		};
+
+		static auto cache() -> Cache&
+		{
+			static thread_local Cache obj;
+			return obj;
+		};
+
+		static auto exited() -> bool&
+		{
+			static thread_local bool flag = false;
+			return flag;
+		};
+	};
+
+	/**
+	 * @brief An allocator with caches of threads.
+	 *
+	 * @details
+	 * <p> PoolAllocator allocates elements from the PoolArena. Each thread allocates and deallocates from
+	 * its own cache of free blocks, without any lock, thus containers of different threads do not contend
+	 * with each other. An element can be deallocated by a thread different from the allocating one. </p>
+	 *
+	 * <p> PoolAllocator has no state; all the PoolAllocator objects are equal, thus containers using it can
+	 * be swapped and moved freely. </p>
+	 *
+	 * @warning
+	 * <p> PoolAllocator makes allocation safe and fast in multi-threading environment, but not the
+	 * containers. If a container is accessed by multiple threads, guard it with RWMutex by yourself. </p>
+	 *
+	 * @tparam T Type of the elements allocated by the object (aliased as member type value_type).
+	 *
+	 * @see library::PoolArena
+	 * @handbook [Library - Critical Section](https://github.com/samchon/framework/wiki/CPP-Library-Critical_Section)
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	template <class T>
+	class PoolAllocator
+	{
+	public:
+		typedef T value_type;
+		typedef T* pointer;
+		typedef const T* const_pointer;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+
+		template <class U>
+		struct rebind
+		{
+			typedef PoolAllocator<U> other;
+		};
+
+		/* ---------------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------------- */
+		/**
+		 * @brief Default Constructor
+		 */
+		PoolAllocator() = default;
+
+		/**
+		 * @brief Copy Constructor from an allocator of another type
+		 */
+		template <class U>
+		PoolAllocator(const PoolAllocator<U> &)
+		{
+		};
+
+		/* ---------------------------------------------------------------
+			ALLOCATION
+		--------------------------------------------------------------- */
+		/**
+		 * @brief Allocate block of storage
+		 *
+		 * @param n Number of elements (each of size sizeof(value_type)) to be allocated.
+		 * @return A pointer to the initial element in the block of storage.
+		 * @throw std::bad_alloc When the storage cannot be allocated.
+		 */
+		auto allocate(size_type n) -> pointer
+		{
+			if (n > std::numeric_limits<size_type>::max() / sizeof(T))
+				throw std::bad_alloc();
+
+			// OVER-ALIGNED TYPES DON'T FIT IN THE BLOCKS
+			if (alignof(T) > PoolArena::ALIGNMENT)
+				return std::allocator<T>().allocate(n);
+
+			return (pointer)PoolArena::allocate(n * sizeof(T));
+		};
+
+		/**
+		 * @brief Release block of storage
+		 *
+		 * @param ptr Pointer to a block of storage previously allocated by allocate().
+		 * @param n Number of elements allocated on the call to allocate() for this block of storage.
+		 */
+		void deallocate(pointer ptr, size_type n)
+		{
+			if (alignof(T) > PoolArena::ALIGNMENT)
+				std::allocator<T>().deallocate(ptr, n);
+			else
+				PoolArena::deallocate(ptr, n * sizeof(T));
+		};
+
+		template <class U>
+		auto operator==(const PoolAllocator<U> &) const -> bool
+		{
+			return true;
+		};
+		template <class U>
+		auto operator!=(const PoolAllocator<U> &) const -> bool
+		{
+			return false;
+		};
+	};
+};
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 
@@ -13,7 +14,15 @@ namespace library
 	 *
 	 * @details
 	 * <p> A mutex divided into reading and writing. </p>
-	 * 
+	 *
+	 * <p> State of the mutex, whether a writer holds it and how many readers hold it, is kept in an atomic
+	 * variable. Thus locking and unlocking without contention cost an atomic operation, without any system
+	 * call. Threads wait on condition variables only when they have to wait. </p>
+	 *
+	 * <p> Writers are preferred. Once a writer is waiting, newly coming readers wait, too, thus a steady
+	 * stream of readers does not starve writers. In the <i>fair</i> mode, readers which had been waiting
+	 * when a writer unlocks go in before the next writer, thus readers are not starved by writers, either. </p>
+	 *
 	 * ![Class Diagram](http://samchon.github.io/framework/images/design/cpp_class_diagram/library_critical_section.png)
 	 *
 	 * @note
@@ -22,42 +31,64 @@ namespace library
 	 * a class like rw_mutex in STL yet. It's the reason why RWMutex is provided. </p>
 	 *
 	 * <p> As that reason, if STL supports the rw_mutex in near future, the RWMutex can be deprecated. </p>
-	 * 
+	 *
+	 * @warning
+	 * <p> Locks are not recursive. Locking on reading again by a thread already holding the lock can dead-lock,
+	 * when a writer is waiting between them. </p>
+	 *
 	 * @handbook [Library - Critical Section](https://github.com/samchon/framework/wiki/CPP-Library-Critical_Section)
 	 * @author Jeongho Nam <http://samchon.org>
 	 */
 	class RWMutex
 	{
 	private:
+		// Bits of the state
+		static const size_t WRITER = (size_t)1 << (sizeof(size_t) * 8 - 1);
+		static const size_t WRITER_WAITING = WRITER >> 1;
+		static const size_t READER_WAITING = WRITER >> 2;
+		static const size_t READERS = READER_WAITING - 1;
+
+		typedef std::chrono::steady_clock clock;
+
 		// Status variables
-		size_t readers_count_;
-		std::atomic<bool> writing_;
+		mutable std::atomic<size_t> state_;
+		bool fair_;
 
-		// Conditional waiters
-		std::condition_variable read_cv_;
-		std::condition_variable write_cv_;
+		// Status of waiters, guarded by the mtx_
+		mutable size_t waiting_readers_;
+		mutable size_t waiting_writers_;
+		mutable size_t read_turn_;
 
-		// Lockers
-		std::mutex readers_count_mtx_;
-		std::mutex read_mtx_;
-		std::mutex write_mtx_;
+		// Conditional waiters
+		mutable std::mutex mtx_;
+		mutable std::condition_variable read_cv_;
+		mutable std::condition_variable write_cv_;
 
 	public:
 		/**
 		 * @brief Default Constructor
+		 *
+		 * @param fair Whether readers having been waiting go in before the next writer.
 		 */
-		RWMutex()
+		RWMutex(bool fair = false)
 		{
-			readers_count_ = 0;
-			writing_ = false;
+			state_ = 0;
+			fair_ = fair;
+
+			waiting_readers_ = 0;
+			waiting_writers_ = 0;
+			read_turn_ = 0;
 		};
 
+		/* =========================================================
+			READ
+		========================================================= */
 		/**
 		 * @brief Lock on read
 		 *
 		 * @details
 		 * <p> Increases a reading count. </p>
-		 * <p> When write_lock is on a progress, wait until write_unlock to be called. </p>
+		 * <p> When write_lock is on a progress or waiting, wait until write_unlock to be called. </p>
 		 *
 		 *	\li Reading can be done by multiple sections.
 		 *	\li Reading can't be done when writing.
@@ -66,16 +97,33 @@ namespace library
 		 */
 		void readLock() const
 		{
-			// WAIT WRITE_UNLOCK
-			std::unique_lock<std::mutex> uk((std::mutex&)read_mtx_);
+			if (try_read_fast() == false)
+				read_slow(false, clock::time_point());
+		};
+
+		/**
+		 * @brief Try to lock on read
+		 *
+		 * @return Whether succeeded to lock, without waiting.
+		 */
+		auto tryReadLock() const -> bool
+		{
+			return try_read_fast();
+		};
 
-			while (writing_ == true)
-				((std::condition_variable&)read_cv_).wait(uk);
+		/**
+		 * @brief Try to lock on read, for a duration
+		 *
+		 * @param duration Maximum duration to wait.
+		 * @return Whether succeeded to lock before the duration.
+		 */
+		template <class Rep, class Period>
+		auto tryReadLockFor(const std::chrono::duration<Rep, Period> &duration) const -> bool
+		{
+			if (try_read_fast() == true)
+				return true;
 
-			// PLUS NUMBER OF READERS
-			((std::mutex&)readers_count_mtx_).lock();
-			((size_t&)readers_count_)++;
-			((std::mutex&)readers_count_mtx_).unlock();
+			return read_slow(true, clock::now() + std::chrono::duration_cast<clock::duration>(duration));
 		};
 
 		/**
@@ -84,30 +132,31 @@ namespace library
 		 * @details
 		 * <p> Decreases a reading count. </p>
 		 *
-		 * <p> When write_lock had done after read_lock, it continues by read_unlock
-		 * if the reading count was 1 (read_unlock makes the count to be zero). </p>
+		 * <p> When write_lock is waiting for the readers, it continues by read_unlock of the last reader. </p>
 		 */
 		void readUnlock() const
 		{
-			std::unique_lock<std::mutex> uk((std::mutex&)readers_count_mtx_);
+			size_t state = state_.fetch_sub(1);
 
-			//  ̹ 0 ( readUnlock )   
-			if (readers_count_ != 0 && --((size_t&)readers_count_) == 0)
+			// THE LAST READER WAKES A WRITER UP
+			if ((state & READERS) == 1 && (state & WRITER_WAITING) != 0)
 			{
-				uk.unlock();
-
-				((std::condition_variable&)read_cv_).notify_all();
-				((std::condition_variable&)write_cv_).notify_all();
+				std::unique_lock<std::mutex> uk(mtx_);
+				write_cv_.notify_one();
 			}
 		};
 
+		/* =========================================================
+			WRITE
+		========================================================= */
 		/**
 		 * @brief Lock on writing
 		 *
 		 * @details
 		 * <p> Changes writing flag to true. </p>
 		 *
-		 * <p> If another write_lock or read_lock is on a progress, wait until them to be unlocked. </p>
+		 * <p> If another write_lock or read_lock is on a progress, wait until them to be unlocked. Readers coming
+		 * after this, wait until write_unlock. </p>
 		 *
 		 *	\li Writing can be done by only a section at once.
 		 *	\li Writing can't be done when reading.
@@ -116,12 +165,33 @@ namespace library
 		 */
 		void writeLock()
 		{
-			std::unique_lock<std::mutex> uk(write_mtx_);
+			if (try_write() == false)
+				write_slow(false, clock::time_point());
+		};
+
+		/**
+		 * @brief Try to lock on writing
+		 *
+		 * @return Whether succeeded to lock, without waiting.
+		 */
+		auto tryWriteLock() -> bool
+		{
+			return try_write();
+		};
 
-			while (writing_ == true || readers_count_ > 0)
-				write_cv_.wait(uk);
+		/**
+		 * @brief Try to lock on writing, for a duration
+		 *
+		 * @param duration Maximum duration to wait.
+		 * @return Whether succeeded to lock before the duration.
+		 */
+		template <class Rep, class Period>
+		auto tryWriteLockFor(const std::chrono::duration<Rep, Period> &duration) -> bool
+		{
+			if (try_write() == true)
+				return true;
 
-			writing_ = true;
+			return write_slow(true, clock::now() + std::chrono::duration_cast<clock::duration>(duration));
 		};
 
 		/**
@@ -129,10 +199,137 @@ namespace library
 		 */
 		void writeUnlock()
 		{
-			writing_ = false;
-			
-			read_cv_.notify_all();
-			write_cv_.notify_all();
+			size_t state = state_.fetch_and(~WRITER);
+			if ((state & (WRITER_WAITING | READER_WAITING)) == 0)
+				return;
+
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			if (fair_ == true && waiting_readers_ != 0)
+			{
+				// READERS HAVING BEEN WAITING GO IN FIRST
+				read_turn_++;
+				read_cv_.notify_all();
+			}
+			else if (waiting_writers_ != 0)
+				write_cv_.notify_one();
+			else
+				read_cv_.notify_all();
+		};
+
+	private:
+		/* =========================================================
+			INTERNAL
+		========================================================= */
+		auto try_read_fast() const -> bool
+		{
+			size_t state = state_.load();
+
+			while ((state & (WRITER | WRITER_WAITING)) == 0)
+				if (state_.compare_exchange_weak(state, state + 1) == true)
+					return true;
+
+			return false;
+		};
+
+		auto try_read_slow(size_t turn) const -> bool
+		{
+			size_t state = state_.load();
+
+			while ((state & WRITER) == 0)
+			{
+				// A WAITING WRITER GOES FIRST, UNLESS IT'S THE READERS' TURN
+				if ((state & WRITER_WAITING) != 0 && (fair_ == false || turn == read_turn_))
+					return false;
+
+				if (state_.compare_exchange_weak(state, state + 1) == true)
+					return true;
+			}
+			return false;
+		};
+
+		auto read_slow(bool timed, clock::time_point deadline) const -> bool
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			size_t turn = read_turn_;
+			bool acquired = false;
+
+			waiting_readers_++;
+			state_.fetch_or(READER_WAITING);
+
+			while (true)
+			{
+				if (try_read_slow(turn) == true)
+				{
+					acquired = true;
+					break;
+				}
+
+				if (timed == false)
+					read_cv_.wait(uk);
+				else if (read_cv_.wait_until(uk, deadline) == std::cv_status::timeout)
+				{
+					acquired = try_read_slow(turn);
+					break;
+				}
+			}
+
+			if (--waiting_readers_ == 0)
+				state_.fetch_and(~READER_WAITING);
+
+			// WRITERS MAY HAVE BEEN WAITING FOR THE TURN OF THIS READER, WHICH HAS GIVEN UP
+			if (acquired == false && waiting_writers_ != 0)
+				write_cv_.notify_one();
+
+			return acquired;
+		};
+
+		auto try_write() -> bool
+		{
+			size_t state = state_.load();
+
+			while ((state & (WRITER | READERS)) == 0)
+				if (state_.compare_exchange_weak(state, state | WRITER) == true)
+					return true;
+
+			return false;
+		};
+
+		auto write_slow(bool timed, clock::time_point deadline) -> bool
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			bool acquired = false;
+
+			// BLOCK NEWLY COMING READERS
+			waiting_writers_++;
+			state_.fetch_or(WRITER_WAITING);
+
+			while (true)
+			{
+				if (try_write() == true)
+				{
+					acquired = true;
+					break;
+				}
+
+				if (timed == false)
+					write_cv_.wait(uk);
+				else if (write_cv_.wait_until(uk, deadline) == std::cv_status::timeout)
+				{
+					acquired = try_write();
+					break;
+				}
+			}
+
+			if (--waiting_writers_ == 0)
+			{
+				state_.fetch_and(~WRITER_WAITING);
+
+				// READERS BLOCKED BY THIS WRITER, WHICH HAS GIVEN UP
+				if (acquired == false)
+					read_cv_.notify_all();
+			}
+			return acquired;
 		};
 	};
 };
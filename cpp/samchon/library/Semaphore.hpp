@@ -1,6 +1,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <list>
 #include <mutex>
 
 namespace samchon
@@ -27,7 +30,11 @@ namespace library
 	 * program is free from these problems. Semaphores which allow an arbitrary resource count are
 	 * called counting semaphores, while semaphores which are restricted to the values 0 and 1
 	 * (or locked/unlocked, unavailable/available) are called binary semaphores </p>
-	 *	\li Categorized in binary semaphore
+	 *
+	 * <p> Admissions are counted by an atomic variable. Thus acquiring and releasing without contention
+	 * cost an atomic operation, without any system call. When the count reaches the capacity, acquirers
+	 * wait in a queue and a released admission is handed over to the first of them; waiters are admitted
+	 * in order of their arrival. </p>
 	 *
 	 * <p> Referenced Wediapedia </p>
 	 *	\li https://en.wikipedia.org/wiki/Semaphore_(programming)
@@ -47,11 +54,22 @@ namespace library
 	class Semaphore
 	{
 	private:
+		typedef std::chrono::steady_clock clock;
+
+		/**
+		 * @brief A waiting acquirer
+		 */
+		struct Waiter
+		{
+			std::condition_variable cv;
+			bool admitted = false;
+		};
+
 		/**
 		 * @brief The size
 		 * @details Permitted size of the semaphore
 		 */
-		size_t capacity_;
+		std::atomic<size_t> capacity_;
 
 		/* ====================================================
 			VARIABLES FOR LOCK
@@ -59,15 +77,20 @@ namespace library
 		/**
 		 * @brief Acquired count
 		 */
-		size_t acquired_;
+		std::atomic<size_t> acquired_;
 
-		std::mutex count_mtx;
+		/**
+		 * @brief Number of waiters
+		 * @details Increased before a waiter checks the count for the last time, thus a releaser never misses it.
+		 */
+		std::atomic<size_t> waiting_;
 
 		/**
-		 * @brief Locker
-		 * @details Manages lock and unlock of the semaphore
+		 * @brief Waiters in order of arrival, guarded by the mtx_
 		 */
-		std::mutex mtx;
+		std::list<Waiter*> waiters_;
+
+		std::mutex mtx_;
 
 	public:
 		/**
@@ -78,18 +101,29 @@ namespace library
 		Semaphore(size_t capacity = 2)
 		{
 			this->acquired_ = 0;
+			this->waiting_ = 0;
 			this->capacity_ = capacity;
 		};
 
+		Semaphore(const Semaphore &) = delete;
+		auto operator=(const Semaphore &) -> Semaphore& = delete;
+
 		/**
 		 * @brief Set size
-		 * @details Set permitted size of the semaphore.
+		 *
+		 * @details
+		 * <p> Set permitted size of the semaphore. </p>
+		 *
+		 * <p> When the size grows, waiters are admitted as many as the grown size. When the size shrinks
+		 * below the acquired count, admissions already acquired are kept and nobody is admitted until
+		 * the count goes down under the new size. </p>
 		 */
 		void setCapacity(size_t val)
 		{
-			std::unique_lock<std::mutex> uk(count_mtx);
+			std::unique_lock<std::mutex> uk(mtx_);
 
 			this->capacity_ = val;
+			admit();
 		};
 
 		/* ====================================================
@@ -114,6 +148,14 @@ namespace library
 			return acquired_;
 		};
 
+		/**
+		 * @brief Get number of waiters.
+		 */
+		auto waiting() const -> size_t
+		{
+			return waiting_;
+		};
+
 		/* ====================================================
 			LOCKERS
 		==================================================== */
@@ -123,27 +165,19 @@ namespace library
 		 * @details
 		 * <p> Acquires an admission and increases count of admission by 1. </p>
 		 * <p> If the count is over permitted size, wait until other admissions to be released. </p>
-		 *	\li Lock on mutex
 		 */
 		void acquire()
 		{
-			std::unique_lock<std::mutex> uk(count_mtx);
-
-			if (++acquired_ == capacity_)
-			{
-				uk.unlock();
-				mtx.lock();
-			}
+			if (try_acquire_fast() == false)
+				acquire_slow(false, clock::time_point());
 		};
 
 		/**
 		 * @brief Try to acquire admission
 		 *
 		 * @details
-		 * <p> If admission count is below the permitted size, acquire admission and increase the
-		 * count by 1 and return true which means succeded to get admission. </p>
-		 *
-		 *	\li If the count is matched to the permitted size, lock the mutex
+		 * <p> If admission count is below the permitted size and nobody is waiting, acquire admission
+		 * and increase the count by 1 and return true which means succeded to get admission. </p>
 		 *
 		 * <p> Else, do not acquire admission and return false which means failed to get admmission. </p>
 		 *
@@ -151,17 +185,22 @@ namespace library
 		 */
 		auto tryAcquire() -> bool
 		{
-			std::unique_lock<std::mutex> uk(count_mtx);
-
-			if (acquired_ == capacity_)
-				return false;
-			else
-			{
-				if (++acquired_ >= capacity_)
-					return mtx.try_lock();
+			return try_acquire_fast();
+		};
 
+		/**
+		 * @brief Try to acquire admission, for a duration
+		 *
+		 * @param duration Maximum duration to wait.
+		 * @return Whether succeded to acquire an admission before the duration.
+		 */
+		template <class Rep, class Period>
+		auto tryAcquireFor(const std::chrono::duration<Rep, Period> &duration) -> bool
+		{
+			if (try_acquire_fast() == true)
 				return true;
-			}
+
+			return acquire_slow(true, clock::now() + std::chrono::duration_cast<clock::duration>(duration));
 		};
 
 		/**
@@ -169,14 +208,96 @@ namespace library
 		 *
 		 * @details
 		 * Releases an admission what you've acquired.
-		 * If the admission count was over the limited size, unlock the mutex.
+		 * If someone is waiting, the admission is handed over to the first waiter.
 		 */
 		void release()
 		{
-			std::unique_lock<std::mutex> uk(count_mtx);
+			size_t acquired = acquired_.load();
+			while (acquired != 0)
+				if (acquired_.compare_exchange_weak(acquired, acquired - 1) == true)
+					break;
+
+			if (waiting_ == 0)
+				return;
+
+			std::unique_lock<std::mutex> uk(mtx_);
+			admit();
+		};
+
+	private:
+		/* ====================================================
+			INTERNAL
+		==================================================== */
+		auto try_increase() -> bool
+		{
+			size_t acquired = acquired_.load();
+
+			while (acquired < capacity_)
+				if (acquired_.compare_exchange_weak(acquired, acquired + 1) == true)
+					return true;
+
+			return false;
+		};
+
+		auto try_acquire_fast() -> bool
+		{
+			// DON'T GO IN BEFORE WAITERS
+			if (waiting_ != 0)
+				return false;
+
+			return try_increase();
+		};
+
+		auto acquire_slow(bool timed, clock::time_point deadline) -> bool
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			waiting_++;
 
-			if (acquired_ != 0 && --acquired_ == capacity_ - 1)
-				mtx.unlock();
+			// NOBODY IS AHEAD, AND AN ADMISSION MAY HAVE BEEN RELEASED
+			if (waiters_.empty() == true && try_increase() == true)
+			{
+				waiting_--;
+				return true;
+			}
+
+			Waiter waiter;
+			auto it = waiters_.insert(waiters_.end(), &waiter);
+
+			while (waiter.admitted == false)
+				if (timed == false)
+					waiter.cv.wait(uk);
+				else if (waiter.cv.wait_until(uk, deadline) == std::cv_status::timeout)
+					break;
+
+			// AN ADMITTED WAITER HAS BEEN REMOVED FROM THE QUEUE BY ITS ADMITTER
+			bool admitted = waiter.admitted;
+			if (admitted == false)
+			{
+				// GIVE UP
+				waiters_.erase(it);
+				waiting_--;
+
+				// WAITERS BEHIND MAY BE ADMITTED, WHEN CAPACITY HAS GROWN
+				admit();
+			}
+			return admitted;
+		};
+
+		/**
+		 * @brief Hands admissions over to waiters, in order of arrival
+		 * @details The mtx_ must be locked.
+		 */
+		void admit()
+		{
+			while (waiters_.empty() == false && try_increase() == true)
+			{
+				Waiter *waiter = waiters_.front();
+				waiters_.pop_front();
+
+				waiter->admitted = true;
+				waiter->cv.notify_one();
+				waiting_--;
+			}
 		};
 	};
 };
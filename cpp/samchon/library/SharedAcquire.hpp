@@ -71,7 +71,7 @@ namespace library
 		SharedAcquire(Semaphore &semaphore, bool lock = true)
 		{
 			this->semaphore = &semaphore;
-			this->reference = new std::atomic<size_t>(0);
+			this->reference = new std::atomic<size_t>(1);
 			this->locked = new std::atomic<bool>(false);
 
 			if (lock == true)
@@ -151,7 +151,27 @@ namespace library
 		/**
 		 * @copydoc Semaphore::tryAcquire()
 		 */
-		 //auto tryAcquire() -> bool;
+		auto tryAcquire() -> bool
+		{
+			if (locked->load() == true)
+				return true;
+
+			locked->store(semaphore->tryAcquire());
+			return locked->load();
+		};
+
+		/**
+		 * @copydoc Semaphore::tryAcquireFor()
+		 */
+		template <class Rep, class Period>
+		auto tryAcquireFor(const std::chrono::duration<Rep, Period> &duration) -> bool
+		{
+			if (locked->load() == true)
+				return true;
+
+			locked->store(semaphore->tryAcquireFor(duration));
+			return locked->load();
+		};
 	};
 };
 };
\ No newline at end of file
@@ -71,11 +71,11 @@ namespace library
 		SharedReadLock(const RWMutex &rw_mutex, bool lock = true)
 		{
 			this->rw_mutex = &rw_mutex;
-			this->reference = new std::atomic<size_t>(0);
+			this->reference = new std::atomic<size_t>(1);
 			this->locked = new std::atomic<bool>(false);
 
 			if (lock == true)
-				rw_mutex.readLock();
+				this->lock();
 		};
 
 		/**
@@ -149,9 +149,29 @@ namespace library
 		};
 
 		/**
-		 * @copydoc RWMutex::tryAcquire()
+		 * @copydoc RWMutex::tryReadLock()
 		 */
-		//auto tryLock() const -> bool;
+		auto tryLock() const -> bool
+		{
+			if (locked->load() == true)
+				return true;
+
+			locked->store(rw_mutex->tryReadLock());
+			return locked->load();
+		};
+
+		/**
+		 * @copydoc RWMutex::tryReadLockFor()
+		 */
+		template <class Rep, class Period>
+		auto tryLockFor(const std::chrono::duration<Rep, Period> &duration) const -> bool
+		{
+			if (locked->load() == true)
+				return true;
+
+			locked->store(rw_mutex->tryReadLockFor(duration));
+			return locked->load();
+		};
 	};
 };
 };
\ No newline at end of file
@@ -71,7 +71,7 @@ namespace library
 		SharedWriteLock(RWMutex &rw_mutex, bool lock = true)
 		{
 			this->rw_mutex = &rw_mutex;
-			this->reference = new std::atomic<size_t>(0);
+			this->reference = new std::atomic<size_t>(1);
 			this->locked = new std::atomic<bool>(false);
 
 			if (lock == true)
@@ -149,9 +149,29 @@ namespace library
 		};
 
 		/**
-		 * @copydoc RWMutex::tryAcquire()
+		 * @copydoc RWMutex::tryWriteLock()
 		 */
-		//auto tryLock() -> bool;
+		auto tryLock() -> bool
+		{
+			if (locked->load() == true)
+				return true;
+
+			locked->store(rw_mutex->tryWriteLock());
+			return locked->load();
+		};
+
+		/**
+		 * @copydoc RWMutex::tryWriteLockFor()
+		 */
+		template <class Rep, class Period>
+		auto tryLockFor(const std::chrono::duration<Rep, Period> &duration) -> bool
+		{
+			if (locked->load() == true)
+				return true;
+
+			locked->store(rw_mutex->tryWriteLockFor(duration));
+			return locked->load();
+		};
 	};
 };
 };
\ No newline at end of file
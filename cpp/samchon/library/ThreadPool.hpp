@@ -0,0 +1,429 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <exception>
+#include <algorithm>
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+
+namespace samchon
+{
+namespace library
+{
+	/**
+	 * A pool of threads executing tasks.
+	 *
+	 * {@link ThreadPool} executes tasks on a fixed number of worker threads, instead of creating a thread for each
+	 * task. Each worker has its own queue; a worker takes the latest task of its own queue first, and steals the
+	 * oldest task of other workers' queues when its own is empty. Tasks submitted from a thread outside of the pool
+	 * are distributed to the queues in turn.
+	 *
+	 * Fan-out of the framework, like {@link templates::external::ExternalSystemArray.sendData sending an Invoke
+	 * message to all the systems}, is done on the {@link shared shared} pool by {@link forEach forEach()}, which
+	 * returns after all the tasks have been done. While waiting, the calling thread executes queued tasks by itself,
+	 * thus a fan-out in a task of the pool does not dead-lock even when all the workers are waiting.
+	 *
+	 * ```cpp
+	 * ThreadPool::shared().forEach(clients.begin(), clients.end(), [&](std::shared_ptr<Client> &client)
+	 * {
+	 *	client->sendData(invoke);
+	 * });
+	 * ```
+	 *
+	 * A task is a blocking job such as writing to a socket, thus a slow task occupies its worker until it's done.
+	 * Size of the pool limits number of tasks executing at the same time; specify it by {@link setSharedSize}
+	 * before the first use of the shared pool.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class ThreadPool
+	{
+	private:
+		typedef std::chrono::steady_clock clock;
+
+		struct Task
+		{
+			std::function<void()> function;
+			clock::time_point time;
+		};
+
+		struct Worker
+		{
+			std::mutex mtx;
+			std::deque<Task> queue;
+		};
+
+		std::vector<std::unique_ptr<Worker>> workers_;
+		std::vector<std::thread> threads_;
+
+		std::mutex sleep_mtx_;
+		std::condition_variable sleep_cv_;
+		bool stopped_;
+
+		std::atomic<size_t> next_;
+
+		/* ---------------------------------------------------------
+			METRICS
+		--------------------------------------------------------- */
+		std::atomic<size_t> queued_;
+		std::atomic<size_t> active_;
+		std::atomic<size_t> completed_;
+
+		std::atomic<long long> total_latency_;
+		std::atomic<long long> max_latency_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from size.
+		 *
+		 * @param size Number of worker threads. Zero means number of the hardware threads.
+		 */
+		ThreadPool(size_t size = 0)
+		{
+			if (size == 0)
+				size = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+			stopped_ = false;
+			next_ = 0;
+
+			queued_ = 0;
+			active_ = 0;
+			completed_ = 0;
+			total_latency_ = 0;
+			max_latency_ = 0;
+
+			workers_.reserve(size);
+			for (size_t i = 0; i < size; i++)
+				workers_.emplace_back(new Worker());
+
+			threads_.reserve(size);
+			for (size_t i = 0; i < size; i++)
+				threads_.emplace_back(&ThreadPool::work, this, i);
+		};
+
+		/**
+		 * Default Destructor.
+		 *
+		 * Waits until the tasks already submitted have been done, and joins the workers.
+		 */
+		~ThreadPool()
+		{
+			{
+				std::unique_lock<std::mutex> uk(sleep_mtx_);
+				stopped_ = true;
+			}
+			sleep_cv_.notify_all();
+
+			for (size_t i = 0; i < threads_.size(); i++)
+				threads_[i].join();
+		};
+
+		/**
+		 * Get the shared pool.
+		 *
+		 * The pool shared by fan-out of the framework. It's created on the first call, with size specified by
+		 * {@link setSharedSize setSharedSize()}.
+		 */
+		static auto shared() -> ThreadPool&
+		{
+			static ThreadPool obj(shared_size());
+			return obj;
+		};
+
+		/**
+		 * Set size of the shared pool.
+		 *
+		 * Must be called before the first use of the {@link shared shared} pool; once the pool has been created, its
+		 * size is not changed.
+		 *
+		 * @param size Number of worker threads. Zero means number of the hardware threads.
+		 */
+		static void setSharedSize(size_t size)
+		{
+			shared_size() = size;
+		};
+
+		/* ---------------------------------------------------------
+			TASKS
+		--------------------------------------------------------- */
+		/**
+		 * Submit a task.
+		 *
+		 * The task is executed later, by a worker. An exception thrown by the task is ignored.
+		 *
+		 * @param task A task to execute.
+		 */
+		void submit(std::function<void()> task)
+		{
+			Task obj{ std::move(task), clock::now() };
+
+			// OWN QUEUE OF A WORKER, OR IN TURN
+			size_t index = (current_pool() == this)
+				? current_index()
+				: next_++ % workers_.size();
+
+			{
+				Worker &worker = *workers_[index];
+				std::unique_lock<std::mutex> uk(worker.mtx);
+
+				worker.queue.push_back(std::move(obj));
+			}
+			queued_++;
+
+			// WAKE A WORKER UP
+			{
+				std::unique_lock<std::mutex> uk(sleep_mtx_);
+			}
+			sleep_cv_.notify_one();
+		};
+
+		/**
+		 * Execute a function for each element, in parallel.
+		 *
+		 * Returns after the *fn* has been done for all the elements. While waiting, the calling thread executes
+		 * queued tasks by itself.
+		 *
+		 * @param first Input iterator to the initial position.
+		 * @param last Input iterator to the final position, which is not included.
+		 * @param fn Function to be called with each element.
+		 *
+		 * @return Number of the elements.
+		 * @throw The first exception thrown by the *fn*, after all the calls have been done.
+		 */
+		template <class Iterator, class Function>
+		auto forEach(Iterator first, Iterator last, Function fn) -> size_t
+		{
+			struct Latch
+			{
+				std::mutex mtx;
+				std::condition_variable cv;
+				size_t count;
+				std::exception_ptr exception;
+			};
+			std::shared_ptr<Latch> latch(new Latch());
+
+			latch->count = 0;
+			for (Iterator it = first; it != last; it++)
+				latch->count++;
+
+			size_t size = latch->count;
+			for (Iterator it = first; it != last; it++)
+				submit([latch, it, &fn]()
+				{
+					std::exception_ptr exception;
+					try
+					{
+						fn(*it);
+					}
+					catch (...)
+					{
+						exception = std::current_exception();
+					}
+
+					std::unique_lock<std::mutex> uk(latch->mtx);
+					if (exception != nullptr && latch->exception == nullptr)
+						latch->exception = exception;
+					if (--latch->count == 0)
+						latch->cv.notify_all();
+				});
+
+			// HELP WORKERS UNTIL ALL THE TASKS ARE DONE
+			while (true)
+			{
+				{
+					std::unique_lock<std::mutex> uk(latch->mtx);
+					if (latch->count == 0)
+						break;
+				}
+
+				if (execute_one(current_pool() == this ? current_index() : 0) == false)
+				{
+					// NOTHING TO EXECUTE; THE REST ARE ON EXECUTION BY WORKERS
+					std::unique_lock<std::mutex> uk(latch->mtx);
+					latch->cv.wait(uk, [&latch]() -> bool
+					{
+						return latch->count == 0;
+					});
+					break;
+				}
+			}
+
+			if (latch->exception != nullptr)
+				std::rethrow_exception(latch->exception);
+
+			return size;
+		};
+
+		/* ---------------------------------------------------------
+			METRICS
+		--------------------------------------------------------- */
+		/**
+		 * Get number of worker threads.
+		 */
+		auto size() const -> size_t
+		{
+			return threads_.size();
+		};
+
+		/**
+		 * Get number of tasks in the queues, which are not started yet.
+		 */
+		auto getQueueLength() const -> size_t
+		{
+			return queued_;
+		};
+
+		/**
+		 * Get number of tasks on execution.
+		 */
+		auto getActiveCount() const -> size_t
+		{
+			return active_;
+		};
+
+		/**
+		 * Get number of tasks have been done.
+		 */
+		auto getCompletedCount() const -> size_t
+		{
+			return completed_;
+		};
+
+		/**
+		 * Get average latency of tasks, from submission to completion, in milliseconds.
+		 */
+		auto getAverageLatency() const -> double
+		{
+			size_t completed = completed_;
+			if (completed == 0)
+				return 0.0;
+
+			return total_latency_ / (double)completed / 1000.0;
+		};
+
+		/**
+		 * Get maximum latency of tasks, from submission to completion, in milliseconds.
+		 */
+		auto getMaxLatency() const -> double
+		{
+			return max_latency_ / 1000.0;
+		};
+
+	private:
+		/* ---------------------------------------------------------
+			WORKERS
+		--------------------------------------------------------- */
+		void work(size_t index)
+		{
+			current_pool() = this;
+			current_index() = index;
+
+			while (true)
+			{
+				if (execute_one(index) == true)
+					continue;
+
+				// SLEEP UNTIL A TASK IS SUBMITTED
+				std::unique_lock<std::mutex> uk(sleep_mtx_);
+				sleep_cv_.wait(uk, [this]() -> bool
+				{
+					return queued_ != 0 || stopped_ == true;
+				});
+
+				if (queued_ == 0 && stopped_ == true)
+					break;
+			}
+		};
+
+		auto execute_one(size_t index) -> bool
+		{
+			Task task;
+			if (pop(index, task) == false)
+				return false;
+
+			queued_--;
+			active_++;
+			{
+				try
+				{
+					task.function();
+				}
+				catch (...)
+				{
+					// NOTHING TO REPORT; forEach() DELIVERS ITS EXCEPTIONS BY ITSELF
+				}
+			}
+			active_--;
+
+			// LATENCY, IN MICROSECONDS
+			long long latency = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - task.time).count();
+			total_latency_ += latency;
+
+			long long max = max_latency_;
+			while (latency > max && max_latency_.compare_exchange_weak(max, latency) == false)
+				continue;
+
+			completed_++;
+			return true;
+		};
+
+		auto pop(size_t index, Task &task) -> bool
+		{
+			// THE LATEST ONE OF ITS OWN QUEUE
+			{
+				Worker &worker = *workers_[index];
+				std::unique_lock<std::mutex> uk(worker.mtx);
+
+				if (worker.queue.empty() == false)
+				{
+					task = std::move(worker.queue.back());
+					worker.queue.pop_back();
+					return true;
+				}
+			}
+
+			// STEAL THE OLDEST ONE FROM OTHERS
+			for (size_t i = 1; i < workers_.size(); i++)
+			{
+				Worker &worker = *workers_[(index + i) % workers_.size()];
+				std::unique_lock<std::mutex> uk(worker.mtx);
+
+				if (worker.queue.empty() == false)
+				{
+					task = std::move(worker.queue.front());
+					worker.queue.pop_front();
+					return true;
+				}
+			}
+			return false;
+		};
+
+		static auto current_pool() -> ThreadPool*&
+		{
+			thread_local ThreadPool *pool = nullptr;
+			return pool;
+		};
+		static auto current_index() -> size_t&
+		{
+			thread_local size_t index = 0;
+			return index;
+		};
+		static auto shared_size() -> size_t&
+		{
+			static size_t size = 0;
+			return size;
+		};
+	};
+};
+};
@@ -136,7 +136,27 @@ namespace library
 		/**
 		 * @copydoc Semaphore::tryAcquire()
 		 */
-		//auto tryAcquire() -> bool;
+		auto tryAcquire() -> bool
+		{
+			if (locked == true)
+				return true;
+
+			locked = semaphore->tryAcquire();
+			return locked;
+		};
+
+		/**
+		 * @copydoc Semaphore::tryAcquireFor()
+		 */
+		template <class Rep, class Period>
+		auto tryAcquireFor(const std::chrono::duration<Rep, Period> &duration) -> bool
+		{
+			if (locked == true)
+				return true;
+
+			locked = semaphore->tryAcquireFor(duration);
+			return locked;
+		};
 	};
 };
 };
\ No newline at end of file
@@ -134,7 +134,27 @@ namespace library
 		/**
 		 * @copydoc RWMutex::tryReadLock()
 		 */
-		//auto tryLock() const -> bool;
+		auto tryLock() const -> bool
+		{
+			if (locked == true)
+				return true;
+
+			(bool&)locked = rw_mutex->tryReadLock();
+			return locked;
+		};
+
+		/**
+		 * @copydoc RWMutex::tryReadLockFor()
+		 */
+		template <class Rep, class Period>
+		auto tryLockFor(const std::chrono::duration<Rep, Period> &duration) const -> bool
+		{
+			if (locked == true)
+				return true;
+
+			(bool&)locked = rw_mutex->tryReadLockFor(duration);
+			return locked;
+		};
 	};
 };
 };
\ No newline at end of file
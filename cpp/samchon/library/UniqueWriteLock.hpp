@@ -136,9 +136,29 @@ namespace library
 		};
 
 		/**
-		 * @copydoc RWMutex::tryLock()
+		 * @copydoc RWMutex::tryWriteLock()
 		 */
-		//auto tryLock() -> bool;
+		auto tryLock() -> bool
+		{
+			if (locked == true)
+				return true;
+
+			locked = rw_mutex->tryWriteLock();
+			return locked;
+		};
+
+		/**
+		 * @copydoc RWMutex::tryWriteLockFor()
+		 */
+		template <class Rep, class Period>
+		auto tryLockFor(const std::chrono::duration<Rep, Period> &duration) -> bool
+		{
+			if (locked == true)
+				return true;
+
+			locked = rw_mutex->tryWriteLockFor(duration);
+			return locked;
+		};
 	};
 };
 };
\ No newline at end of file
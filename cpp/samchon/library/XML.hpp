@@ -3,7 +3,7 @@
 
 #include <vector>
 #include <string>
-#include <queue>
+#include <cstring>
 #include <memory>
 #include <sstream>
 
@@ -69,6 +69,9 @@ namespace library
 	class XML
 		: public HashMap<std::string, std::shared_ptr<XMLList>>
 	{
+		friend class XMLDocument;
+		friend class XMLReader;
+
 	private:
 		typedef HashMap<std::string, std::shared_ptr<XMLList>> super;
 
@@ -143,282 +146,292 @@ namespace library
 		*/
 		XML(WeakString wstr) : super()
 		{
-			if (wstr.find('<') == std::string::npos)
-				return;
-
-			//WHEN COMMENT IS
-			std::string replacedStr;
-			if (wstr.find("<!--") != std::string::npos)
-			{
-				std::queue<std::pair<size_t, size_t>> indexPairQueue;
-				size_t beginX = 0, endX;
-
-				//CONSTRUCT INDEXES
-				replacedStr.reserve(wstr.size());
-				while ((beginX = wstr.find("<!--", beginX)) != std::string::npos)
-				{
-					indexPairQueue.push({ beginX, wstr.find("-->", beginX + 1) + 3 });
-					beginX++;
-				}
-
-				//INSERT STRINGS
-				beginX = 0;
-				while (indexPairQueue.empty() == false)
-				{
-					endX = indexPairQueue.front().first;
-					replacedStr.append(wstr.substring(beginX, endX).str());
-
-					beginX = indexPairQueue.front().second;
-					indexPairQueue.pop();
-				}
-				replacedStr.append(wstr.substr(beginX).str());
-
-				//RE-REFERENCE
-				wstr = replacedStr;
-			}
-
-			//ERASE HEADERS OF XML
-			if (wstr.find("<?xml") != std::string::npos)
-				wstr = wstr.between("?>");
-
-			parse(wstr);
+			parse(wstr.data(), wstr.data() + wstr.size());
 		};
 
 	private:
-		XML(XML *parent, WeakString &wstr) : XML()
-		{
-			parse(wstr);
-		};
-
 		/* -------------------------------------------------------------
 			PARSERS
 		------------------------------------------------------------- */
-		void parse(WeakString &wstr)
+		/**
+		 * Parse a string in a single pass.
+		 *
+		 * Tokens are read from left to right, keeping a stack of opened elements. Comments, declarations and 
+		 * processing instructions are skipped where they are met, thus the string is never copied nor scanned again.
+		 */
+		void parse(const char *first, const char *last)
 		{
-			parse_key(wstr);
-			parse_properties(wstr);
+			struct Frame
+			{
+				XML *xml;
+				std::string text;
+			};
 
-			if (parse_value(wstr) == true)
-				parse_children(wstr);
-		};
+			// THE ROOT ELEMENT
+			const char *it = first;
+			if (skip_to_element(it, last) == false)
+				return;
 
-		void parse_key(WeakString &wstr)
-		{
-			size_t startX = wstr.find("<") + 1;
-			size_t endX =
-				calc_min_index
-				(
-					{
-						wstr.find(' ', startX),
-						wstr.find("\r\n", startX),
-						wstr.find('\n', startX),
-						wstr.find('\t', startX),
-						wstr.find('>', startX),
-						wstr.find('/', startX)
-					}
-				);
+			std::vector<Frame> stack;
+			if (parse_start_tag(it, last) == true)
+				stack.push_back({ this, std::string() });
 
-			//Determinate the KEY
-			tag_ = move( wstr.substring(startX, endX).str() );
-		};
-		
-		void parse_properties(WeakString &wstr)
-		{
-			// INLINE CLASS
-			class QuotePair
+			while (stack.empty() == false)
 			{
-			public:
-				enum TYPE : int
-				{
-					SINGLE = 1,
-					DOUBLE = 2
-				};
+				Frame &frame = stack.back();
 
-				TYPE type;
-				size_t start_index;
-				size_t end_index;
+				// TEXT, VALUE OF A LEAF
+				const char *text_last = (const char*)memchr(it, '<', last - it);
+				if (text_last == nullptr)
+					text_last = last;
 
-				QuotePair(TYPE type, size_t start_index, size_t end_index)
+				if (frame.xml->empty() == true)
+					frame.text.append(it, text_last);
+				it = text_last;
+
+				if (it == last)
 				{
-					this->type = type;
-					this->start_index = start_index;
-					this->end_index = end_index;
-				};
-			};
+					// NOT CLOSED, CLOSE ALL
+					while (stack.empty() == false)
+					{
+						stack.back().xml->close_element(stack.back().text);
+						stack.pop_back();
+					}
+					break;
+				}
 
-			size_t i_begin = wstr.find('<' + tag_) + tag_.size() + 1;
-			size_t i_endSlash = wstr.rfind('/');
-			size_t i_endBlock = wstr.find('>', i_begin);
+				if (starts_with(it, last, "<!--"))
+					it = skip_after(it + 4, last, "-->");
+				else if (starts_with(it, last, "<![CDATA["))
+				{
+					const char *data_last = find_token(it + 9, last, "]]>");
+					if (frame.xml->empty() == true)
+						frame.text.append(it + 9, data_last);
 
-			size_t i_end = calc_min_index({ i_endSlash, i_endBlock });
-			if (i_end == std::string::npos || i_begin >= i_end)
-				return;
+					it = skip_after(data_last, last, "]]>");
+				}
+				else if (starts_with(it, last, "<?"))
+					it = skip_after(it + 2, last, "?>");
+				else if (starts_with(it, last, "<!"))
+					it = skip_after(it + 2, last, ">");
+				else if (starts_with(it, last, "</"))
+				{
+					// END TAG
+					it = skip_after(it + 2, last, ">");
 
-			//<comp label='ABCD' /> : " label='ABCD' "
-			WeakString &line = wstr.substring(i_begin, i_end); 
+					frame.xml->close_element(frame.text);
+					stack.pop_back();
+				}
+				else
+				{
+					// CHILD ELEMENT
+					std::shared_ptr<XML> child(new XML());
+					bool opened = child->parse_start_tag(it, last);
 
-			if (line.find('=') == std::string::npos)
-				return;
+					frame.xml->push_back(child);
+					if (opened == true)
+						stack.push_back({ child.get(), std::string() });
+				}
+			}
+		};
 
-			std::string label, value;
-			std::vector<QuotePair*> helpers;
-			bool inQuote = false;
-			QuotePair::TYPE type;
-			size_t startPoint, equalPoint;
-			size_t i;
+		/**
+		 * Parse a start tag; tag and properties.
+		 *
+		 * @return Whether the element is opened. False if the element is closed by itself; <TAG />.
+		 */
+		auto parse_start_tag(const char *&it, const char *last) -> bool
+		{
+			// TAG
+			const char *tag_first = ++it;
+			while (it != last && is_space(*it) == false && *it != '>' && *it != '/')
+				it++;
+			tag_.assign(tag_first, it);
 
-			for (i = 0; i < line.size(); i++) 
+			// PROPERTIES
+			while (true)
 			{
-				//Start of quote
-				if (inQuote == false && (line[i] == '\'' || line[i] == '"'))
-				{
-					inQuote = true;
-					startPoint = i;
+				while (it != last && is_space(*it) == true)
+					it++;
 
-					if (line[i] == '\'')
-						type = QuotePair::SINGLE;
-					else if (line[i] == '"')
-						type = QuotePair::DOUBLE;
+				if (it == last)
+					return false;
+				else if (*it == '>')
+				{
+					it++;
+					return true;
 				}
-				else if
-					(
-						inQuote == true &&
-						(
-							(type == QuotePair::SINGLE && line[i] == '\'') ||
-							(type == QuotePair::DOUBLE && line[i] == '"')
-						)
-					)
+				else if (*it == '/')
 				{
-					helpers.push_back(new QuotePair(type, startPoint, i));
-					inQuote = false;
+					it = skip_after(it, last, ">");
+					return false;
 				}
-			}
-			for (i = 0; i < helpers.size(); i++)
-			{
-				if (i == 0)
+
+				// KEY
+				const char *key_first = it;
+				while (it != last && *it != '=' && *it != '>' && *it != '/' && is_space(*it) == false)
+					it++;
+				const char *key_last = it;
+
+				while (it != last && is_space(*it) == true)
+					it++;
+				if (it == last || *it != '=')
+					continue; // NO VALUE, IGNORED
+
+				it++;
+				while (it != last && is_space(*it) == true)
+					it++;
+				if (it == last)
+					return false;
+
+				// VALUE IN QUOTES
+				const char *value_first;
+				const char *value_last;
+
+				if (*it == '"' || *it == '\'')
 				{
-					equalPoint = (long long)line.find('=');
-					label = move( line.substring(0, equalPoint).trim().str() );
+					value_first = it + 1;
+					value_last = (const char*)memchr(value_first, *it, last - value_first);
+					if (value_last == nullptr)
+						value_last = last;
+
+					it = (value_last == last) ? last : value_last + 1;
 				}
 				else
 				{
-					equalPoint = line.find('=', helpers[i - 1]->end_index + 1);
-					label = line.substring(helpers[i - 1]->end_index + 1, equalPoint).trim().str();
+					value_first = it;
+					while (it != last && is_space(*it) == false && *it != '>')
+						it++;
+					value_last = it;
 				}
-		
-				value = 
-					move
-					(
-						decodeProperty
-						(
-							line.substring
-							(
-								helpers[i]->start_index + 1,
-								helpers[i]->end_index
-							)
-						)
-					);
-		
-				//INSERT INTO PROPERTY_MAP
-				property_map_.set(label, move(value));
-			}
-			for (i = 0; i < helpers.size(); i++)
-				delete helpers[i];
-		};
-		
-		auto parse_value(WeakString &wstr) -> bool
-		{
-			size_t i_endSlash = wstr.rfind('/');
-			size_t i_endBlock = wstr.find('>');
 
-			if (i_endSlash < i_endBlock || i_endBlock + 1 == wstr.rfind('<'))
-			{
-				//STATEMENT1: <TAG />
-				//STATEMENT2: <TAG></TAG> -> SAME WITH STATEMENT1: <TAG />
-				value_.clear();
-				return false;
+				property_map_.set
+				(
+					std::string(key_first, key_last), 
+					decodeProperty(WeakString(value_first, value_last))
+				);
 			}
+		};
 
-			size_t startX = i_endBlock + 1;
-			size_t endX = wstr.rfind('<');
-			wstr = wstr.substring(startX, endX); //REDEFINE WEAK_STRING -> IN TO THE TAG
-
-			if (wstr.find('<') == std::string::npos)
-				value_ = wstr.trim();
+		void close_element(const std::string &text)
+		{
+			if (empty() == true)
+				value_ = WeakString(text).trim().str();
 			else
 				value_.clear();
-
-			return true;
 		};
-		
-		void parse_children(WeakString &wstr)
-		{
-			if (wstr.find('<') == std::string::npos)
-				return;
-
-			size_t startX = wstr.find('<');
-			size_t endX = wstr.rfind('>') + 1;
-			wstr = wstr.substring(startX, endX);
-
-			/*map<std::string, queue<XML *>> xmlQueueMap;
-			queue<XML*> *xmlQueue;
-			XML *xml;*/
 
-			int blockStartCount = 0;
-			int blockEndCount = 0;
-			size_t start = 0;
-			size_t end;
-			size_t i;
-
-			//FIND BLOCKS, CREATES XML AND PUT IN TEMPORARY CONTAINER
-			for (i = 0; i < wstr.size(); i++) 
+		/**
+		 * Move to the first element, skipping declarations, comments and processing instructions.
+		 */
+		static auto skip_to_element(const char *&it, const char *last) -> bool
+		{
+			while (true)
 			{
-				if (wstr[i] == '<' && wstr.substr(i, 2) != "</")
-					blockStartCount++;
-				else if (wstr.substr(i, 2) == "/>" || wstr.substr(i, 2) == "</")
-					blockEndCount++;
-
-				if (blockStartCount >= 1 && blockStartCount == blockEndCount) 
+				it = (const char*)memchr(it, '<', last - it);
+				if (it == nullptr)
 				{
-					//NO PROBLEM TO AVOID COMMENT
-					end = wstr.find('>', i);
-
-					/*xml = new XML(this, wstr.substring(start, end + 1));
-					xmlQueueMap[xml->tag].push(xml);*/
+					it = last;
+					return false;
+				}
 
-					std::shared_ptr<XML> xml(new XML(this, wstr.substring(start, end + 1)));
-					push_back(xml);
+				if (starts_with(it, last, "<!--"))
+					it = skip_after(it + 4, last, "-->");
+				else if (starts_with(it, last, "<?"))
+					it = skip_after(it + 2, last, "?>");
+				else if (starts_with(it, last, "<!"))
+					it = skip_after(it + 2, last, ">");
+				else
+					return true;
+			}
+		};
 
-					i = end; //WHY NOT END+1? 
-					start = end + 1;
-					blockStartCount = 0;
-					blockEndCount = 0;
+		/**
+		 * Skip content of an opened element, without parsing.
+		 *
+		 * @param it Position just after the start tag.
+		 * @return Position just after the matched end tag.
+		 */
+		static auto skip_element(const char *it, const char *last) -> const char*
+		{
+			size_t depth = 1;
+			while (true)
+			{
+				it = (const char*)memchr(it, '<', last - it);
+				if (it == nullptr)
+					return last;
+
+				if (starts_with(it, last, "<!--"))
+					it = skip_after(it + 4, last, "-->");
+				else if (starts_with(it, last, "<![CDATA["))
+					it = skip_after(it + 9, last, "]]>");
+				else if (starts_with(it, last, "<?"))
+					it = skip_after(it + 2, last, "?>");
+				else if (starts_with(it, last, "<!"))
+					it = skip_after(it + 2, last, ">");
+				else if (starts_with(it, last, "</"))
+				{
+					it = skip_after(it + 2, last, ">");
+					if (--depth == 0)
+						return it;
+				}
+				else
+				{
+					// START TAG, QUOTED VALUES CAN CONTAIN '>'
+					char quote = 0;
+					for (it++; it != last; it++)
+						if (quote != 0)
+						{
+							if (*it == quote)
+								quote = 0;
+						}
+						else if (*it == '"' || *it == '\'')
+							quote = *it;
+						else if (*it == '>')
+							break;
+
+					if (it == last)
+						return last;
+					else if (*(it - 1) != '/')
+						depth++;
+					it++;
 				}
 			}
+		};
 
-			//RESERVE
-			/*for (auto it = xmlQueueMap.begin(); it != xmlQueueMap.end(); it++)
+		template <size_t N>
+		static auto starts_with(const char *it, const char *last, const char (&token)[N]) -> bool
+		{
+			return (size_t)(last - it) >= N - 1 && memcmp(it, token, N - 1) == 0;
+		};
+
+		template <size_t N>
+		static auto find_token(const char *it, const char *last, const char (&token)[N]) -> const char*
+		{
+			while ((size_t)(last - it) >= N - 1)
 			{
-				std::string tag = move(it->first); //GET KEY
-				shared_ptr<XMLList> xmlList(new XMLList());
+				it = (const char*)memchr(it, token[0], last - it - (N - 2));
+				if (it == nullptr)
+					break;
+				else if (memcmp(it, token, N - 1) == 0)
+					return it;
 
-				xmlQueue = &(it->second);
-				xmlList->reserve(xmlQueue->size()); //RESERVE
+				it++;
+			}
+			return last;
+		};
 
-				//MOVE QUEUE TO XML_LIST
-				while (xmlQueue->empty() == false)
-				{
-					xml = xmlQueue->front();
-					xmlList->push_back(shared_ptr<XML>(xml));
+		template <size_t N>
+		static auto skip_after(const char *it, const char *last, const char (&token)[N]) -> const char*
+		{
+			it = find_token(it, last, token);
 
-					xmlQueue->pop();
-				}
-				//INSERT IN MAP BY KEY
-				insert({ tag, xmlList });
-			}*/
+			return (it == last) ? last : it + (N - 1);
+		};
 
-			if (size() > 0)
-				value_.clear();
+		static auto is_space(char ch) -> bool
+		{
+			return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n';
 		};
 
 	public:
@@ -715,7 +728,7 @@ namespace library
 			if (wstr.empty() == true)
 				return;
 
-			std::shared_ptr<XML> xml(new XML(this, wstr));
+			std::shared_ptr<XML> xml(new XML(wstr));
 			auto it = find(xml->tag_);
 
 			//if not exists
@@ -825,26 +838,32 @@ namespace library
 		/* -----------------------------------------------------------
 			FILTERS
 		----------------------------------------------------------- */
-		auto calc_min_index(const std::vector<size_t> &vec) const -> size_t
+		/**
+		 * Append a value escaped, in a single pass.
+		 *
+		 * Runs of characters not to be escaped are appended at once.
+		 */
+		static void encode_value(std::string &buffer, const WeakString &wstr)
 		{
-			size_t val = std::string::npos;
-			for (size_t i = 0; i < vec.size(); i++)
-				if (vec[i] != std::string::npos && vec[i] < val)
-					val = vec[i];
+			const char *first = wstr.data();
+			const char *last = first + wstr.size();
 
-			return val;
-		};
-
-		auto encode_value(const WeakString &wstr) const -> std::string
-		{
-			static std::vector<std::pair<std::string, std::string>> pairArray =
+			for (const char *it = first; it != last; it++)
 			{
-				{ "&", "&amp;" },
-				{ "<", "&lt;" },
-				{ ">", "&gt;" }
-			};
+				const char *entity;
+				switch (*it)
+				{
+				case '&': entity = "&amp;"; break;
+				case '<': entity = "&lt;"; break;
+				case '>': entity = "&gt;"; break;
+				default: continue;
+				}
 
-			return wstr.replaceAll(pairArray);
+				buffer.append(first, it);
+				buffer.append(entity);
+				first = it + 1;
+			}
+			buffer.append(first, last);
 		};
 		
 		auto decode_value(const WeakString &wstr) const -> std::string
@@ -859,25 +878,44 @@ namespace library
 			return wstr.replaceAll(pairArray);
 		};
 		
-		auto encode_property(const WeakString &wstr) const -> std::string
+		/**
+		 * Append a property trimmed and escaped, in a single pass.
+		 */
+		static void encode_property(std::string &buffer, const WeakString &str)
 		{
-			static std::vector<std::pair<std::string, std::string>> pairArray =
+			WeakString wstr = str.trim();
+
+			const char *first = wstr.data();
+			const char *last = first + wstr.size();
+
+			for (const char *it = first; it != last; it++)
 			{
-				{ "&", "&amp;" },
-				{ "<", "&lt;" },
-				{ ">", "&gt;" },
-				{ "\"", "&quot;" },
-				{ "'", "&apos;" },
-				{ "\t", "&#x9;" }, //9
-				{ "\n", "&#xA;" }, //10
-				{ "\r", "&#xD;" } //13
-			};
+				const char *entity;
+				switch (*it)
+				{
+				case '&': entity = "&amp;"; break;
+				case '<': entity = "&lt;"; break;
+				case '>': entity = "&gt;"; break;
+				case '"': entity = "&quot;"; break;
+				case '\'': entity = "&apos;"; break;
+				case '\t': entity = "&#x9;"; break;
+				case '\n': entity = "&#xA;"; break;
+				case '\r': entity = "&#xD;"; break;
+				default: continue;
+				}
 
-			return wstr.trim().replaceAll(pairArray);
+				buffer.append(first, it);
+				buffer.append(entity);
+				first = it + 1;
+			}
+			buffer.append(first, last);
 		};
 		
 		auto decodeProperty(const WeakString &wstr) const -> std::string
 		{
+			if (wstr.find('&') == std::string::npos)
+				return wstr.str();
+
 			static std::vector<std::pair<std::string, std::string>> pairArray =
 			{
 				{ "&amp;", "&" },
@@ -906,35 +944,78 @@ namespace library
 		 * @return The string representation of the {@link XML} object.
 		 */
 		auto toString(size_t level = 0) const -> std::string
+		{
+			std::string str;
+			write(str, false, level);
+
+			return str;
+		};
+
+		/**
+		 * Write xml string on a buffer.
+		 *
+		 * Appends a string representation of the {@link XML} object to the *buffer*. The whole tree is written on 
+		 * the one *buffer*, without temporary strings of children and properties.
+		 *
+		 * The compact mode omits indentation and line breaks, which only a human reader needs. It's what a network 
+		 * message should use.
+		 *
+		 * @param buffer A buffer to append the string.
+		 * @param compact Whether to omit indentation and line breaks.
+		 * @param level Number of tabs to spacing, ignored in the compact mode.
+		 */
+		void write(std::string &buffer, bool compact = false, size_t level = 0) const
 		{
 			// KEY
-			std::string str = std::string(level, '\t') + "<" + tag_;
+			if (compact == false)
+				buffer.append(level, '\t');
+			buffer += '<';
+			buffer += tag_;
 
 			// PROPERTIES
 			for (auto it = property_map_.begin(); it != property_map_.end(); it++)
-				str += " " + it->first + "=\"" + encode_property(it->second) + "\"";
+			{
+				buffer += ' ';
+				buffer += it->first;
+				buffer += "=\"";
+				encode_property(buffer, it->second);
+				buffer += '"';
+			}
 
 			if (this->empty() == true)
 			{
 				// VALUE
 				if (value_.empty() == true)
-					str += " />";
+					buffer += compact ? "/>" : " />";
 				else
-					str += ">" + encode_value(value_) + "</" + tag_ + ">";
+				{
+					buffer += '>';
+					encode_value(buffer, value_);
+					buffer += "</";
+					buffer += tag_;
+					buffer += '>';
+				}
 			}
 			else
 			{
 				// CHILDREN
-				str += ">\n";
+				buffer += '>';
+				if (compact == false)
+					buffer += '\n';
 
 				for (auto it = begin(); it != end(); it++)
 					for (size_t i = 0; i < it->second->size(); i++)
-						str += it->second->at(i)->toString(level + 1);
+						it->second->at(i)->write(buffer, compact, level + 1);
 
-				str += std::string(level, '\t') + "</" + tag_ + ">";
+				if (compact == false)
+					buffer.append(level, '\t');
+				buffer += "</";
+				buffer += tag_;
+				buffer += '>';
 			}
 
-			return str + "\n";
+			if (compact == false)
+				buffer += '\n';
 		};
 	};
 };
@@ -0,0 +1,872 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <deque>
+#include <vector>
+#include <algorithm>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <atomic>
+#include <mutex>
+#include <samchon/WeakString.hpp>
+#include <samchon/library/XML.hpp>
+
+namespace samchon
+{
+namespace library
+{
+	class XMLDocument;
+
+	/**
+	 * A property of an {@link XMLNode}.
+	 *
+	 * Both key and value are views into the string of the {@link XMLDocument}. The value is escaped until it's
+	 * requested first.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	struct XMLProperty
+	{
+		WeakString key;
+		WeakString value;
+		bool escaped;
+
+		XMLProperty *next;
+	};
+
+	/**
+	 * An element of an {@link XMLDocument}.
+	 *
+	 * The {@link XMLNode} is a read-only view of an element, allocated in the arena of its {@link XMLDocument}. Its
+	 * tag, properties and value are not copied, but refer to the string of the document. Children are linked in the
+	 * order they're written.
+	 *
+	 * Escaped properties and values are decoded when they're requested first, and the decoded strings are kept in
+	 * the document. Decoding and unfolding are serialized by a mutex of the document, thus a node can be read by 
+	 * several threads at the same time.
+	 *
+	 * A node deeper than the depth to parse, of the document, is *folded*; its tag and properties are parsed, but its
+	 * value and children are parsed when they're requested first. Its {@link getSource source} can be read by an
+	 * {@link XMLReader} without unfolding.
+	 *
+	 * A node is valid only while its {@link XMLDocument} is alive.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class XMLNode
+	{
+		friend class XMLDocument;
+
+	private:
+		WeakString tag_;
+
+		mutable WeakString value_;
+		mutable std::atomic<bool> value_escaped_;
+
+		XMLProperty *first_property_;
+		XMLProperty *last_property_;
+		mutable std::atomic<bool> properties_escaped_;
+
+		XMLNode *first_child_;
+		XMLNode *last_child_;
+		XMLNode *next_sibling_;
+
+		const char *source_first_;
+		const char *content_first_;
+		const char *source_last_;
+		mutable std::atomic<bool> folded_;
+
+		XMLDocument *document_;
+
+	public:
+		/* -------------------------------------------------------------
+			CONSTRUCTORS
+		------------------------------------------------------------- */
+		/**
+		 * Constructor.
+		 *
+		 * @param document The document the node belongs to.
+		 * @warning Nodes are created by an {@link XMLDocument} only.
+		 */
+		XMLNode(XMLDocument *document)
+		{
+			value_escaped_ = false;
+
+			first_property_ = nullptr;
+			last_property_ = nullptr;
+			properties_escaped_ = false;
+
+			first_child_ = nullptr;
+			last_child_ = nullptr;
+			next_sibling_ = nullptr;
+
+			source_first_ = nullptr;
+			content_first_ = nullptr;
+			source_last_ = nullptr;
+			folded_ = false;
+
+			document_ = document;
+		};
+
+		/* -------------------------------------------------------------
+			GETTERS
+		------------------------------------------------------------- */
+		/**
+		 * Get tag.
+		 */
+		auto getTag() const -> WeakString
+		{
+			return tag_;
+		};
+
+		/**
+		 * Test whether a property exists.
+		 */
+		auto hasProperty(const WeakString &key) const -> bool
+		{
+			return find_property(key) != nullptr;
+		};
+
+		/**
+		 * Get value.
+		 *
+		 * @tparam T Type of the value; a number, bool, std::string or {@link WeakString}.
+		 */
+		template<class T = std::string> auto getValue() const -> T
+		{
+			double val = std::stod(getValue<std::string>());
+
+			return (T)val;
+		};
+
+		template<> auto getValue() const -> bool
+		{
+			return getValue<WeakString>() == "true";
+		};
+
+		template<> auto getValue() const -> std::string
+		{
+			return getValue<WeakString>().str();
+		};
+		template<> auto getValue() const -> WeakString
+		{
+			unfold();
+			if (value_escaped_ == true)
+				decode_value();
+
+			return value_;
+		};
+
+		/**
+		 * Get property.
+		 *
+		 * @tparam T Type of the property; a number, bool, std::string or {@link WeakString}.
+		 * @throw std::out_of_range The *key* does not exist.
+		 */
+		template<class T = std::string> auto getProperty(const WeakString &key) const -> T
+		{
+			double val = std::stod(getProperty<std::string>(key));
+
+			return (T)val;
+		};
+
+		template<> auto getProperty(const WeakString &key) const -> bool
+		{
+			WeakString val = getProperty<WeakString>(key);
+
+			return val == "true" || val == "1";
+		};
+
+		template<> auto getProperty(const WeakString &key) const -> std::string
+		{
+			return getProperty<WeakString>(key).str();
+		};
+		template<> auto getProperty(const WeakString &key) const -> WeakString
+		{
+			if (properties_escaped_ == true)
+				decode_properties();
+
+			XMLProperty *property = find_property(key);
+			if (property == nullptr)
+				throw std::out_of_range("unable to find the matched property: " + key.str());
+
+			return property->value;
+		};
+
+		/* -------------------------------------------------------------
+			CHILDREN
+		------------------------------------------------------------- */
+		/**
+		 * Test whether the node has no child.
+		 */
+		auto empty() const -> bool
+		{
+			unfold();
+			return first_child_ == nullptr;
+		};
+
+		/**
+		 * Get the first child.
+		 *
+		 * @return The first child, or nullptr if the node has no child.
+		 */
+		auto getFirstChild() const -> const XMLNode*
+		{
+			unfold();
+			return first_child_;
+		};
+
+		/**
+		 * Get the next sibling.
+		 *
+		 * @return The next child of the parent, or nullptr if this node is the last one.
+		 */
+		auto getNextSibling() const -> const XMLNode*
+		{
+			return next_sibling_;
+		};
+
+		/**
+		 * Find the first child with a tag.
+		 *
+		 * @return The matched child, or nullptr if not found.
+		 */
+		auto findChild(const WeakString &tag) const -> const XMLNode*
+		{
+			unfold();
+			return find_node(first_child_, tag);
+		};
+
+		/**
+		 * Find the next sibling with a tag.
+		 *
+		 * ```cpp
+		 * for (const XMLNode *child = node->findChild("item"); child != nullptr; child = child->findNextSibling("item"))
+		 *	...
+		 * ```
+		 *
+		 * @return The matched sibling, or nullptr if not found.
+		 */
+		auto findNextSibling(const WeakString &tag) const -> const XMLNode*
+		{
+			return find_node(next_sibling_, tag);
+		};
+
+		/**
+		 * Get source.
+		 *
+		 * @return The string of the element, from its start tag to its end tag.
+		 */
+		auto getSource() const -> WeakString
+		{
+			return WeakString(source_first_, source_last_);
+		};
+
+		/**
+		 * Test whether the node is folded; its value and children are not parsed yet.
+		 */
+		auto isFolded() const -> bool
+		{
+			return folded_;
+		};
+
+		/* -------------------------------------------------------------
+			EXPORTERS
+		------------------------------------------------------------- */
+		/**
+		 * Convert to an {@link XML} object.
+		 *
+		 * Copies the node and its descendants into a new {@link XML} object, which is independent of the document.
+		 * Properties and values are decoded.
+		 */
+		auto toXML() const -> std::shared_ptr<XML>
+		{
+			std::shared_ptr<XML> xml(new XML());
+			xml->setTag(tag_.str());
+
+			for (XMLProperty *property = first_property_; property != nullptr; property = property->next)
+				xml->setProperty(property->key.str(), getProperty<std::string>(property->key));
+
+			if (empty() == true)
+				xml->setValue(getValue<std::string>());
+			else
+				for (const XMLNode *child = first_child_; child != nullptr; child = child->next_sibling_)
+					xml->push_back(child->toXML());
+
+			return xml;
+		};
+
+	private:
+		/* -------------------------------------------------------------
+			HELPERS
+		------------------------------------------------------------- */
+		auto find_property(const WeakString &key) const -> XMLProperty*
+		{
+			// THE LAST ONE, AS THE XML OVERWRITES DUPLICATED KEYS
+			XMLProperty *ret = nullptr;
+			for (XMLProperty *property = first_property_; property != nullptr; property = property->next)
+				if (property->key == key)
+					ret = property;
+
+			return ret;
+		};
+
+		static auto find_node(const XMLNode *node, const WeakString &tag) -> const XMLNode*
+		{
+			while (node != nullptr && (node->tag_ == tag) == false)
+				node = node->next_sibling_;
+
+			return node;
+		};
+
+		/**
+		 * Decode a string into the arena of strings, which is kept by the document.
+		 */
+		auto decode(const WeakString &wstr) const -> WeakString;
+
+		/**
+		 * Decode the value, under the mutex of the document.
+		 */
+		void decode_value() const;
+
+		/**
+		 * Decode all the escaped properties at once, under the mutex of the document.
+		 */
+		void decode_properties() const;
+
+		/**
+		 * Parse value and children, if folded.
+		 */
+		void unfold() const;
+
+	public:
+		/**
+		 * Append a string decoded, in a single pass.
+		 *
+		 * Named entities of XML and numeric character references are decoded. Unknown entities are left as they are.
+		 */
+		static void decode(std::string &buffer, const WeakString &wstr)
+		{
+			const char *first = wstr.data();
+			const char *last = first + wstr.size();
+
+			buffer.reserve(buffer.size() + wstr.size());
+
+			for (const char *it = first; it != last; )
+			{
+				it = (const char*)memchr(it, '&', last - it);
+				if (it == nullptr)
+					break;
+
+				const char *end = (const char*)memchr(it, ';', std::min<size_t>(last - it, 12));
+				if (end == nullptr)
+				{
+					it++;
+					continue;
+				}
+
+				WeakString name(it + 1, end);
+				unsigned long code = 0;
+
+				if (name == "amp")
+					code = '&';
+				else if (name == "lt")
+					code = '<';
+				else if (name == "gt")
+					code = '>';
+				else if (name == "quot")
+					code = '"';
+				else if (name == "apos")
+					code = '\'';
+				else if (name.size() >= 2 && name[0] == '#')
+				{
+					char *code_last;
+					if (name[1] == 'x' || name[1] == 'X')
+						code = std::strtoul(name.data() + 2, &code_last, 16);
+					else
+						code = std::strtoul(name.data() + 1, &code_last, 10);
+
+					if (code_last != end || code > 0x10FFFF)
+						code = 0;
+				}
+
+				if (code == 0)
+				{
+					it++;
+					continue;
+				}
+
+				buffer.append(first, it);
+				append_utf8(buffer, code);
+
+				first = it = end + 1;
+			}
+			buffer.append(first, last);
+		};
+
+	private:
+		static void append_utf8(std::string &buffer, unsigned long code)
+		{
+			if (code < 0x80)
+				buffer += (char)code;
+			else if (code < 0x800)
+			{
+				buffer += (char)(0xC0 | (code >> 6));
+				buffer += (char)(0x80 | (code & 0x3F));
+			}
+			else if (code < 0x10000)
+			{
+				buffer += (char)(0xE0 | (code >> 12));
+				buffer += (char)(0x80 | ((code >> 6) & 0x3F));
+				buffer += (char)(0x80 | (code & 0x3F));
+			}
+			else
+			{
+				buffer += (char)(0xF0 | (code >> 18));
+				buffer += (char)(0x80 | ((code >> 12) & 0x3F));
+				buffer += (char)(0x80 | ((code >> 6) & 0x3F));
+				buffer += (char)(0x80 | (code & 0x3F));
+			}
+		};
+	};
+
+	/**
+	 * An XML document in an arena.
+	 *
+	 * The {@link XMLDocument} is an alternative of the {@link XML} object, for reading a large message once. The
+	 * string is retained by the document, and {@link XMLNode nodes} are allocated in arenas of the document. Tags,
+	 * property names and values of the nodes are views into the string; nothing is copied while parsing. Escaped
+	 * values are decoded lazily, when they're requested.
+	 *
+	 * Nodes do not own anything, thus the whole document is freed in one step, with the arenas and the string, when
+	 * the document is destructed. An {@link XML} object, by contrast, allocates its tag, value, property map and
+	 * list of children for each element.
+	 *
+	 * Elements deeper than a depth given to the constructor are folded; they're skipped by counting tags only, and
+	 * parsed when they're requested. A folded element can also be read by an {@link XMLReader} from its 
+	 * {@link XMLNode.getSource source}, not to build nodes at all.
+	 *
+	 * The document is read-only. Convert a node by {@link XMLNode.toXML XMLNode.toXML()} to modify it.
+	 *
+	 * ```cpp
+	 * std::shared_ptr<XMLDocument> document(new XMLDocument(str));
+	 * const XMLNode *root = document->getRoot();
+	 *
+	 * for (const XMLNode *child = root->findChild("item"); child != nullptr; child = child->findNextSibling("item"))
+	 *	std::cout << child->getProperty<WeakString>("name") << std::endl;
+	 * ```
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class XMLDocument
+	{
+	private:
+		std::string str_;
+
+		friend class XMLNode;
+
+		std::deque<XMLNode> nodes_;
+		std::deque<XMLProperty> properties_;
+		std::deque<std::string> strings_;
+
+		/**
+		 * Mutex for decoding and unfolding nodes lazily, which append to the arenas.
+		 */
+		mutable std::mutex mtx_;
+
+		XMLNode *root_;
+
+	public:
+		/* -------------------------------------------------------------
+			CONSTRUCTORS
+		------------------------------------------------------------- */
+		/**
+		 * Construct from string.
+		 *
+		 * The *wstr* is copied once, to be retained by the document. Elements deeper than the *depth* are folded; they
+		 * are skipped without parsing until they're requested.
+		 *
+		 * @param wstr A string represents XML structure.
+		 * @param depth Depth of elements to parse, the root is zero. Deeper elements are folded.
+		 */
+		XMLDocument(const WeakString &wstr, size_t depth = SIZE_MAX)
+			: str_(wstr.data(), wstr.size())
+		{
+			parse(depth);
+		};
+
+		/**
+		 * Construct from string, taking it.
+		 *
+		 * @param str A string represents XML structure.
+		 * @param depth Depth of elements to parse, the root is zero. Deeper elements are folded.
+		 */
+		XMLDocument(std::string &&str, size_t depth = SIZE_MAX)
+			: str_(move(str))
+		{
+			parse(depth);
+		};
+
+		// NODES REFER TO MEMBERS OF THE DOCUMENT
+		XMLDocument(const XMLDocument &) = delete;
+		auto operator=(const XMLDocument &) -> XMLDocument& = delete;
+
+		/* -------------------------------------------------------------
+			GETTERS
+		------------------------------------------------------------- */
+		/**
+		 * Get the root element.
+		 *
+		 * @return The root element, or nullptr if the string has no element.
+		 */
+		auto getRoot() const -> const XMLNode*
+		{
+			return root_;
+		};
+
+		/**
+		 * Get number of elements parsed.
+		 */
+		auto size() const -> size_t
+		{
+			std::lock_guard<std::mutex> lk(mtx_);
+			return nodes_.size();
+		};
+
+	private:
+		/* -------------------------------------------------------------
+			PARSERS
+		------------------------------------------------------------- */
+		/**
+		 * Parse the string in a single pass.
+		 *
+		 * Same with {@link XML}'s parser, but nodes are taken from the arena and text is not copied. Text of a leaf
+		 * is copied only when it's split by comments or CDATA sections.
+		 */
+		void parse(size_t depth)
+		{
+			const char *first = str_.data();
+			const char *last = first + str_.size();
+
+			// THE ROOT ELEMENT
+			root_ = nullptr;
+
+			const char *it = first;
+			if (XML::skip_to_element(it, last) == false)
+				return;
+
+			root_ = create_node(it);
+			if (parse_start_tag(root_, it, last) == false)
+				root_->source_last_ = it;
+			else if (depth == 0)
+				fold(root_, it, last);
+			else
+				parse_content(root_, it, last, depth);
+		};
+
+		/**
+		 * Parse content of an opened element, until its end tag.
+		 *
+		 * @param node The opened element.
+		 * @param depth Depth of descendants to parse. Deeper ones are folded.
+		 */
+		void parse_content(XMLNode *node, const char *&it, const char *last, size_t depth)
+		{
+			struct Frame
+			{
+				XMLNode *node;
+
+				const char *text_first;
+				const char *text_last;
+				bool cdata;
+
+				std::string *joined;
+			};
+
+			std::vector<Frame> stack;
+			stack.push_back({ node, nullptr, nullptr, false, nullptr });
+
+			while (stack.empty() == false)
+			{
+				Frame &frame = stack.back();
+
+				// TEXT, VALUE OF A LEAF
+				const char *text_last = (const char*)memchr(it, '<', last - it);
+				if (text_last == nullptr)
+					text_last = last;
+
+				if (frame.node->first_child_ == nullptr)
+					append_text(frame, it, text_last, false);
+				it = text_last;
+
+				if (it == last)
+				{
+					// NOT CLOSED, CLOSE ALL
+					while (stack.empty() == false)
+					{
+						close_node(stack.back(), last);
+						stack.pop_back();
+					}
+					break;
+				}
+
+				if (XML::starts_with(it, last, "<!--"))
+					it = XML::skip_after(it + 4, last, "-->");
+				else if (XML::starts_with(it, last, "<![CDATA["))
+				{
+					const char *data_last = XML::find_token(it + 9, last, "]]>");
+					if (frame.node->first_child_ == nullptr)
+						append_text(frame, it + 9, data_last, true);
+
+					it = XML::skip_after(data_last, last, "]]>");
+				}
+				else if (XML::starts_with(it, last, "<?"))
+					it = XML::skip_after(it + 2, last, "?>");
+				else if (XML::starts_with(it, last, "<!"))
+					it = XML::skip_after(it + 2, last, ">");
+				else if (XML::starts_with(it, last, "</"))
+				{
+					// END TAG
+					it = XML::skip_after(it + 2, last, ">");
+
+					close_node(frame, it);
+					stack.pop_back();
+				}
+				else
+				{
+					// CHILD ELEMENT
+					XMLNode *child = create_node(it);
+					bool opened = parse_start_tag(child, it, last);
+
+					XMLNode *parent = frame.node;
+					if (parent->first_child_ == nullptr)
+						parent->first_child_ = child;
+					else
+						parent->last_child_->next_sibling_ = child;
+					parent->last_child_ = child;
+
+					if (opened == false)
+						child->source_last_ = it;
+					else if (stack.size() >= depth)
+						fold(child, it, last);
+					else
+						stack.push_back({ child, nullptr, nullptr, false, nullptr });
+				}
+			}
+		};
+
+		void fold(XMLNode *node, const char *&it, const char *last)
+		{
+			node->content_first_ = it;
+			node->folded_ = true;
+
+			it = XML::skip_element(it, last);
+			node->source_last_ = it;
+		};
+
+		auto create_node(const char *source_first) -> XMLNode*
+		{
+			nodes_.emplace_back(this);
+
+			XMLNode *node = &nodes_.back();
+			node->source_first_ = source_first;
+
+			return node;
+		};
+
+		/**
+		 * Parse a start tag; tag and properties.
+		 *
+		 * @return Whether the element is opened. False if the element is closed by itself; <TAG />.
+		 */
+		auto parse_start_tag(XMLNode *node, const char *&it, const char *last) -> bool
+		{
+			// TAG
+			const char *tag_first = ++it;
+			while (it != last && XML::is_space(*it) == false && *it != '>' && *it != '/')
+				it++;
+			node->tag_ = WeakString(tag_first, it);
+
+			// PROPERTIES
+			while (true)
+			{
+				while (it != last && XML::is_space(*it) == true)
+					it++;
+
+				if (it == last)
+					return false;
+				else if (*it == '>')
+				{
+					it++;
+					return true;
+				}
+				else if (*it == '/')
+				{
+					it = XML::skip_after(it, last, ">");
+					return false;
+				}
+
+				// KEY
+				const char *key_first = it;
+				while (it != last && *it != '=' && *it != '>' && *it != '/' && XML::is_space(*it) == false)
+					it++;
+				const char *key_last = it;
+
+				while (it != last && XML::is_space(*it) == true)
+					it++;
+				if (it == last || *it != '=')
+					continue; // NO VALUE, IGNORED
+
+				it++;
+				while (it != last && XML::is_space(*it) == true)
+					it++;
+				if (it == last)
+					return false;
+
+				// VALUE IN QUOTES
+				const char *value_first;
+				const char *value_last;
+
+				if (*it == '"' || *it == '\'')
+				{
+					value_first = it + 1;
+					value_last = (const char*)memchr(value_first, *it, last - value_first);
+					if (value_last == nullptr)
+						value_last = last;
+
+					it = (value_last == last) ? last : value_last + 1;
+				}
+				else
+				{
+					value_first = it;
+					while (it != last && XML::is_space(*it) == false && *it != '>')
+						it++;
+					value_last = it;
+				}
+
+				bool escaped = memchr(value_first, '&', value_last - value_first) != nullptr;
+				properties_.push_back
+				({
+					WeakString(key_first, key_last),
+					WeakString(value_first, value_last),
+					escaped,
+					nullptr
+				});
+				if (escaped == true)
+					node->properties_escaped_ = true;
+
+				XMLProperty *property = &properties_.back();
+				if (node->first_property_ == nullptr)
+					node->first_property_ = property;
+				else
+					node->last_property_->next = property;
+				node->last_property_ = property;
+			}
+		};
+
+		template <class Frame>
+		void append_text(Frame &frame, const char *first, const char *last, bool cdata)
+		{
+			if (first == last)
+				return;
+
+			if (frame.joined == nullptr && frame.text_first == nullptr)
+			{
+				// THE FIRST PIECE, JUST REFER TO IT
+				frame.text_first = first;
+				frame.text_last = last;
+				frame.cdata = cdata;
+				return;
+			}
+			else if (frame.joined == nullptr)
+			{
+				// SPLIT BY A COMMENT OR CDATA, THEN JOIN PIECES DECODED
+				strings_.emplace_back();
+				frame.joined = &strings_.back();
+
+				append_piece(*frame.joined, frame.text_first, frame.text_last, frame.cdata);
+			}
+			append_piece(*frame.joined, first, last, cdata);
+		};
+
+		static void append_piece(std::string &buffer, const char *first, const char *last, bool cdata)
+		{
+			if (cdata == true)
+				buffer.append(first, last);
+			else
+				XMLNode::decode(buffer, WeakString(first, last));
+		};
+
+		template <class Frame>
+		void close_node(Frame &frame, const char *source_last)
+		{
+			XMLNode *node = frame.node;
+			node->source_last_ = source_last;
+
+			if (node->first_child_ != nullptr)
+				return;
+
+			if (frame.joined != nullptr)
+				node->value_ = WeakString(*frame.joined).trim();
+			else if (frame.text_first != nullptr)
+			{
+				node->value_ = WeakString(frame.text_first, frame.text_last).trim();
+				node->value_escaped_ = (frame.cdata == false && node->value_.find('&') != std::string::npos);
+			}
+		};
+	};
+
+	inline auto XMLNode::decode(const WeakString &wstr) const -> WeakString
+	{
+		std::deque<std::string> &strings = document_->strings_;
+		strings.emplace_back();
+
+		decode(strings.back(), wstr);
+		return strings.back();
+	};
+
+	inline void XMLNode::decode_value() const
+	{
+		std::lock_guard<std::mutex> lk(document_->mtx_);
+		if (value_escaped_ == false)
+			return; // DECODED BY ANOTHER THREAD
+
+		value_ = decode(value_);
+		value_escaped_ = false;
+	};
+
+	inline void XMLNode::decode_properties() const
+	{
+		std::lock_guard<std::mutex> lk(document_->mtx_);
+		if (properties_escaped_ == false)
+			return; // DECODED BY ANOTHER THREAD
+
+		for (XMLProperty *property = first_property_; property != nullptr; property = property->next)
+			if (property->escaped == true)
+			{
+				property->value = decode(property->value);
+				property->escaped = false;
+			}
+		properties_escaped_ = false;
+	};
+
+	inline void XMLNode::unfold() const
+	{
+		if (folded_ == false)
+			return;
+
+		std::lock_guard<std::mutex> lk(document_->mtx_);
+		if (folded_ == false)
+			return; // UNFOLDED BY ANOTHER THREAD
+
+		// PARSED INTO THE DOCUMENT'S ARENA, AS IF IT WAS NOT FOLDED; PUBLISHED BY THE FLAG
+		const char *it = content_first_;
+		document_->parse_content(const_cast<XMLNode*>(this), it, source_last_, SIZE_MAX);
+
+		folded_ = false;
+	};
+};
+};
@@ -0,0 +1,510 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <deque>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <samchon/WeakString.hpp>
+#include <samchon/library/XML.hpp>
+#include <samchon/library/XMLDocument.hpp>
+
+namespace samchon
+{
+namespace library
+{
+	/**
+	 * A pull parser of XML.
+	 *
+	 * The {@link XMLReader} reads a string token by token, on request of the {@link read read()} method, without
+	 * building any tree. It keeps only tags and properties of the elements opened, as views into the string; memory
+	 * of the reader is a small window, regardless of size of the string.
+	 *
+	 * Each call of {@link read read()} moves the reader to the next start tag or end tag. An element closed by
+	 * itself, <TAG />, is reported as a start tag followed by an end tag. Properties of an element can be read
+	 * both on its start tag and on its end tag, thus an object can read its members after its children.
+	 *
+	 * ```cpp
+	 * XMLReader reader(str); // <travel distance="3.2"><point uid="1" /><point uid="2" /></travel>
+	 * reader.read(); // START_ELEMENT OF THE TRAVEL
+	 *
+	 * while (reader.read() == XMLReader::START_ELEMENT) // A POINT
+	 * {
+	 *	int uid = reader.getProperty<int>("uid");
+	 *	reader.skip(); // TO ITS END_ELEMENT
+	 * }
+	 * double distance = reader.getProperty<double>("distance"); // END_ELEMENT OF THE TRAVEL
+	 * ```
+	 *
+	 * {@link protocol::Entity} objects can be constructed from a reader, by {@link protocol::EntityBase.construct
+	 * EntityBase.construct()}, without building an {@link XML} object.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class XMLReader
+	{
+	public:
+		/**
+		 * Events to be read.
+		 */
+		enum Event
+		{
+			START_DOCUMENT = 0,
+			START_ELEMENT = 1,
+			END_ELEMENT = 2,
+			END_DOCUMENT = 3
+		};
+
+	private:
+		/**
+		 * An element opened.
+		 */
+		struct Element
+		{
+			WeakString tag;
+			const char *source_first;
+
+			size_t property_first;
+			size_t decoded_size;
+		};
+
+		std::string str_;
+		const char *it_;
+		const char *last_;
+
+		Event event_;
+		bool self_closed_;
+
+		std::vector<Element> elements_;
+		std::vector<XMLProperty> properties_;
+		std::deque<std::string> decoded_;
+
+	public:
+		/* -------------------------------------------------------------
+			CONSTRUCTORS
+		------------------------------------------------------------- */
+		/**
+		 * Construct from string.
+		 *
+		 * The *wstr* is not copied, thus it must be kept while reading.
+		 *
+		 * @param wstr A string represents XML structure.
+		 */
+		XMLReader(const WeakString &wstr)
+		{
+			it_ = wstr.data();
+			last_ = it_ + wstr.size();
+
+			initialize();
+		};
+
+		/**
+		 * Construct from string, taking it.
+		 *
+		 * @param str A string represents XML structure.
+		 */
+		XMLReader(std::string &&str)
+			: str_(move(str))
+		{
+			it_ = str_.data();
+			last_ = it_ + str_.size();
+
+			initialize();
+		};
+
+		// VIEWS REFER TO THE STRING
+		XMLReader(const XMLReader &) = delete;
+		auto operator=(const XMLReader &) -> XMLReader& = delete;
+
+	private:
+		void initialize()
+		{
+			event_ = START_DOCUMENT;
+			self_closed_ = false;
+
+			// TO THE ROOT ELEMENT
+			if (XML::skip_to_element(it_, last_) == false)
+				event_ = END_DOCUMENT;
+		};
+
+	public:
+		/* -------------------------------------------------------------
+			READERS
+		------------------------------------------------------------- */
+		/**
+		 * Read the next start tag or end tag.
+		 *
+		 * Text and comments are passed over. Elements not closed at end of the string are closed by end tags.
+		 *
+		 * @return The event read.
+		 */
+		auto read() -> Event
+		{
+			if (event_ == END_DOCUMENT)
+				return event_;
+			else if (event_ == START_ELEMENT && self_closed_ == true)
+			{
+				// <TAG />, THEN ITS END
+				self_closed_ = false;
+				return event_ = END_ELEMENT;
+			}
+			else if (event_ == END_ELEMENT)
+			{
+				close_element();
+
+				// ONLY ONE ROOT
+				if (elements_.empty() == true)
+					return event_ = END_DOCUMENT;
+			}
+
+			while (true)
+			{
+				it_ = (const char*)memchr(it_, '<', last_ - it_);
+				if (it_ == nullptr)
+				{
+					// NOT CLOSED, CLOSE ALL
+					it_ = last_;
+					return event_ = elements_.empty() ? END_DOCUMENT : END_ELEMENT;
+				}
+
+				if (XML::starts_with(it_, last_, "<!--"))
+					it_ = XML::skip_after(it_ + 4, last_, "-->");
+				else if (XML::starts_with(it_, last_, "<![CDATA["))
+					it_ = XML::skip_after(it_ + 9, last_, "]]>");
+				else if (XML::starts_with(it_, last_, "<?"))
+					it_ = XML::skip_after(it_ + 2, last_, "?>");
+				else if (XML::starts_with(it_, last_, "<!"))
+					it_ = XML::skip_after(it_ + 2, last_, ">");
+				else if (XML::starts_with(it_, last_, "</"))
+				{
+					it_ = XML::skip_after(it_ + 2, last_, ">");
+					return event_ = END_ELEMENT;
+				}
+				else
+				{
+					open_element();
+					return event_ = START_ELEMENT;
+				}
+			}
+		};
+
+		/**
+		 * Skip the current element.
+		 *
+		 * On a start tag, skips value and children of the element and moves to its end tag. Otherwise, does nothing.
+		 */
+		void skip()
+		{
+			if (event_ != START_ELEMENT)
+				return;
+			else if (self_closed_ == false)
+				it_ = XML::skip_element(it_, last_);
+
+			self_closed_ = false;
+			event_ = END_ELEMENT;
+		};
+
+		/**
+		 * Read value of the current element.
+		 *
+		 * On a start tag, reads text of the element and moves to its end tag. The value is trimmed and decoded, like
+		 * {@link XMLNode.getValue XMLNode.getValue()}. If the element has children, the value is empty and the
+		 * children are skipped.
+		 *
+		 * @return The value.
+		 */
+		auto readValue() -> std::string
+		{
+			std::string value;
+			if (event_ != START_ELEMENT || self_closed_ == true)
+			{
+				skip();
+				return value;
+			}
+
+			while (true)
+			{
+				const char *text_last = (const char*)memchr(it_, '<', last_ - it_);
+				if (text_last == nullptr)
+					text_last = last_;
+
+				XMLNode::decode(value, WeakString(it_, text_last));
+				it_ = text_last;
+
+				if (it_ == last_)
+					break;
+				else if (XML::starts_with(it_, last_, "<!--"))
+					it_ = XML::skip_after(it_ + 4, last_, "-->");
+				else if (XML::starts_with(it_, last_, "<![CDATA["))
+				{
+					const char *data_last = XML::find_token(it_ + 9, last_, "]]>");
+					value.append(it_ + 9, data_last);
+
+					it_ = XML::skip_after(data_last, last_, "]]>");
+				}
+				else if (XML::starts_with(it_, last_, "</"))
+				{
+					it_ = XML::skip_after(it_ + 2, last_, ">");
+					break;
+				}
+				else if (XML::starts_with(it_, last_, "<?"))
+					it_ = XML::skip_after(it_ + 2, last_, "?>");
+				else if (XML::starts_with(it_, last_, "<!"))
+					it_ = XML::skip_after(it_ + 2, last_, ">");
+				else
+				{
+					// HAS CHILDREN, THEN NO VALUE
+					value.clear();
+					it_ = XML::skip_element(it_, last_);
+					break;
+				}
+			}
+
+			event_ = END_ELEMENT;
+			return WeakString(value).trim().str();
+		};
+
+		/**
+		 * Read the current element as an {@link XML} object.
+		 *
+		 * On a start tag, builds an {@link XML} object of the element, with its value and children, and moves to its
+		 * end tag. It's for an object who can't be constructed by a reader.
+		 *
+		 * @return An {@link XML} object, or nullptr if the reader is not on a start tag.
+		 */
+		auto readElement() -> std::shared_ptr<XML>
+		{
+			if (event_ != START_ELEMENT)
+				return nullptr;
+
+			const char *source_first = elements_.back().source_first;
+			skip();
+
+			return std::make_shared<XML>(WeakString(source_first, it_));
+		};
+
+		/* -------------------------------------------------------------
+			GETTERS
+		------------------------------------------------------------- */
+		/**
+		 * Get the last event.
+		 */
+		auto getEvent() const -> Event
+		{
+			return event_;
+		};
+
+		/**
+		 * Get tag of the current element.
+		 */
+		auto getTag() const -> WeakString
+		{
+			return elements_.empty() ? WeakString() : elements_.back().tag;
+		};
+
+		/**
+		 * Get depth of the current element, the root is zero.
+		 */
+		auto getDepth() const -> size_t
+		{
+			return elements_.size() - 1;
+		};
+
+		/**
+		 * Get the current element, without its value and children.
+		 *
+		 * @return An {@link XML} object having tag and properties of the current element.
+		 */
+		auto getElement() -> std::shared_ptr<XML>
+		{
+			std::shared_ptr<XML> xml(new XML());
+			if (elements_.empty() == true)
+				return xml;
+
+			xml->setTag(getTag().str());
+			for (size_t i = elements_.back().property_first; i < properties_.size(); i++)
+				xml->setProperty(properties_[i].key.str(), getProperty<std::string>(properties_[i].key));
+
+			return xml;
+		};
+
+		/**
+		 * Test whether a property exists in the current element.
+		 */
+		auto hasProperty(const WeakString &key) const -> bool
+		{
+			return find_property(key) != nullptr;
+		};
+
+		/**
+		 * Get property of the current element.
+		 *
+		 * @tparam T Type of the property; a number, bool, std::string or {@link WeakString}.
+		 * @throw std::out_of_range The *key* does not exist.
+		 */
+		template<class T = std::string> auto getProperty(const WeakString &key) -> T
+		{
+			double val = std::stod(getProperty<std::string>(key));
+
+			return (T)val;
+		};
+
+		template<> auto getProperty(const WeakString &key) -> bool
+		{
+			WeakString val = getProperty<WeakString>(key);
+
+			return val == "true" || val == "1";
+		};
+
+		template<> auto getProperty(const WeakString &key) -> std::string
+		{
+			return getProperty<WeakString>(key).str();
+		};
+		template<> auto getProperty(const WeakString &key) -> WeakString
+		{
+			XMLProperty *property = find_property(key);
+			if (property == nullptr)
+				throw std::out_of_range("unable to find the matched property: " + key.str());
+
+			if (property->escaped == true)
+			{
+				decoded_.emplace_back();
+				XMLNode::decode(decoded_.back(), property->value);
+
+				property->value = decoded_.back();
+				property->escaped = false;
+			}
+			return property->value;
+		};
+
+		template <typename T = std::string>
+		auto fetchProperty(const WeakString &key, const T &def = T()) -> T
+		{
+			if (hasProperty(key))
+				return getProperty<T>(key);
+			else
+				return def;
+		};
+
+	private:
+		/* -------------------------------------------------------------
+			HELPERS
+		------------------------------------------------------------- */
+		void open_element()
+		{
+			Element element;
+			element.source_first = it_;
+			element.property_first = properties_.size();
+			element.decoded_size = decoded_.size();
+
+			// TAG
+			const char *tag_first = ++it_;
+			while (it_ != last_ && XML::is_space(*it_) == false && *it_ != '>' && *it_ != '/')
+				it_++;
+			element.tag = WeakString(tag_first, it_);
+
+			elements_.push_back(element);
+			self_closed_ = !parse_properties();
+		};
+
+		void close_element()
+		{
+			if (elements_.empty() == true)
+				return;
+
+			// PROPERTIES AND DECODED STRINGS OF THE ELEMENT ARE RELEASED
+			Element &element = elements_.back();
+			properties_.resize(element.property_first);
+			decoded_.resize(element.decoded_size);
+
+			elements_.pop_back();
+		};
+
+		/**
+		 * @return Whether the element is opened. False if the element is closed by itself; <TAG />.
+		 */
+		auto parse_properties() -> bool
+		{
+			while (true)
+			{
+				while (it_ != last_ && XML::is_space(*it_) == true)
+					it_++;
+
+				if (it_ == last_)
+					return false;
+				else if (*it_ == '>')
+				{
+					it_++;
+					return true;
+				}
+				else if (*it_ == '/')
+				{
+					it_ = XML::skip_after(it_, last_, ">");
+					return false;
+				}
+
+				// KEY
+				const char *key_first = it_;
+				while (it_ != last_ && *it_ != '=' && *it_ != '>' && *it_ != '/' && XML::is_space(*it_) == false)
+					it_++;
+				const char *key_last = it_;
+
+				while (it_ != last_ && XML::is_space(*it_) == true)
+					it_++;
+				if (it_ == last_ || *it_ != '=')
+					continue; // NO VALUE, IGNORED
+
+				it_++;
+				while (it_ != last_ && XML::is_space(*it_) == true)
+					it_++;
+				if (it_ == last_)
+					return false;
+
+				// VALUE IN QUOTES
+				const char *value_first;
+				const char *value_last;
+
+				if (*it_ == '"' || *it_ == '\'')
+				{
+					value_first = it_ + 1;
+					value_last = (const char*)memchr(value_first, *it_, last_ - value_first);
+					if (value_last == nullptr)
+						value_last = last_;
+
+					it_ = (value_last == last_) ? last_ : value_last + 1;
+				}
+				else
+				{
+					value_first = it_;
+					while (it_ != last_ && XML::is_space(*it_) == false && *it_ != '>')
+						it_++;
+					value_last = it_;
+				}
+
+				properties_.push_back
+				({
+					WeakString(key_first, key_last),
+					WeakString(value_first, value_last),
+					memchr(value_first, '&', value_last - value_first) != nullptr,
+					nullptr
+				});
+			}
+		};
+
+		auto find_property(const WeakString &key) const -> XMLProperty*
+		{
+			if (elements_.empty() == true)
+				return nullptr;
+
+			// THE LAST ONE, AS THE XML OVERWRITES DUPLICATED KEYS
+			for (size_t i = properties_.size(); i > elements_.back().property_first; i--)
+				if (properties_[i - 1].key == key)
+					return (XMLProperty*)&properties_[i - 1];
+
+			return nullptr;
+		};
+	};
+};
+};
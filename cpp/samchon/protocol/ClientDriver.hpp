@@ -35,8 +35,11 @@ namespace protocol
 	 * @author Jeongho Nam <http://samchon.org>
 	 */
 	class ClientDriver
-		: public virtual Communicator
+		: public virtual Communicator,
+		public std::enable_shared_from_this<ClientDriver>
 	{
+		friend class Server;
+
 	public:
 		ClientDriver(std::shared_ptr<boost::asio::ip::tcp::socket> socket)
 			: Communicator()
@@ -52,6 +55,11 @@ namespace protocol
 		 * converted to {@link Invoke} classes and shifted to the *listener*'s {@link IProtocol.replyData replyData()} 
 		 * method. 
 		 * 
+		 * If the {@link Server} is running on a thread pool (default), this method returns immediately and messages are 
+		 * listened asynchronously. Otherwise, this method is blocked until the connection is closed. In both cases, 
+		 * {@link onClose} is called when the connection has closed. Thus, define what to do with the closed client in 
+		 * the {@link onClose}, not after this method.
+		 * 
 		 * @param listener A listener object to listen replied message from newly connected client in 
 		 *				   {@link IProtocol.replyData replyData()} as an {@link Invoke} object.
 		 */
@@ -59,7 +67,15 @@ namespace protocol
 		{
 			this->listener = listener;
 
-			listen_message();
+			// THE REQUEST OF BINARY MODE IS WRITTEN ASYNCHRONOUSLY, HOLDING THIS OBJECT
+			if (asynchronous == true)
+				set_self(shared_from_this());
+			request_binary_mode();
+
+			if (asynchronous == true)
+				listen_async(shared_from_this());
+			else
+				listen_message();
 		};
 	};
 };
@@ -3,13 +3,24 @@
 
 #include <samchon/protocol/IProtocol.hpp>
 #include <samchon/protocol/IListener.hpp>
+#include <samchon/protocol/InvokeFrame.hpp>
 
 #include <iostream>
 #include <array>
 #include <exception>
 #include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <queue>
+#include <functional>
+#include <vector>
+#include <algorithm>
+#include <cstring>
 #include <boost/asio.hpp>
 #include <samchon/ByteArray.hpp>
+#include <samchon/WeakString.hpp>
 
 namespace samchon
 {
@@ -41,15 +52,172 @@ namespace protocol
 		: public virtual IProtocol
 	{
 	protected:
+		/**
+		 * Flags written on the first byte of a frame's size header.
+		 */
+		enum FrameFlag : unsigned char
+		{
+			BINARY_INVOKE = 0x80,
+			COMPRESSED = 0x40
+		};
+
+		/**
+		 * An encoded message waiting to be sent.
+		 */
+		struct OutboundMessage
+		{
+			/**
+			 * Source of the message, keeping its {@link ByteArray} parameters alive.
+			 */
+			std::shared_ptr<Invoke> invoke;
+
+			/**
+			 * Encoding shared with other messages of a broadcast, which the {@link buffers} may point.
+			 */
+			std::shared_ptr<const void> shared;
+
+			std::string text;
+			ByteArray body;
+			std::vector<ByteArray> compressed_bodies;
+			std::vector<std::array<unsigned char, 14>> headers;
+
+			/**
+			 * Keys of buffers to be masked while being written, paired with indices in the {@link buffers}.
+			 */
+			std::vector<std::pair<size_t, std::array<unsigned char, 4>>> masks;
+
+			/**
+			 * Buffers to write, pointing the members above and the {@link invoke}.
+			 */
+			std::vector<boost::asio::const_buffer> buffers;
+			size_t size = 0;
+
+			/**
+			 * Indices of {@link buffers} where the message can be interrupted by an {@link urgent} message.
+			 */
+			std::vector<size_t> boundaries;
+
+			/**
+			 * Whether to be written prior to queued messages, like control frames of web-socket.
+			 */
+			bool urgent = false;
+
+			/**
+			 * Whether to close the connection after the message is written, like a close frame of web-socket.
+			 */
+			bool closing = false;
+
+			/**
+			 * Number of {@link buffers} and bytes taken by the writer.
+			 */
+			size_t progress = 0;
+			size_t taken = 0;
+		};
+
 		std::shared_ptr<boost::asio::ip::tcp::socket> socket;
 		IProtocol *listener;
 
+		/**
+		 * Whether the {@link socket} is served by threads running its *io_service*.
+		 */
+		bool asynchronous;
+
 		std::mutex send_mtx;
 
+	private:
+		// WRITTEN BY THE LISTENER, READ BY SENDERS
+		std::atomic<bool> binary_mode;
+		bool binary_mode_requested;
+		bool document_mode;
+		size_t compression_threshold;
+		size_t max_message_size;
+
+		std::shared_ptr<Invoke> binary_invoke;
+		std::queue<std::shared_ptr<InvokeParameter>> binary_parameters;
+
+		/**
+		 * Default maximum size of a message to receive, 64 MB.
+		 */
+		static const size_t MAX_MESSAGE_SIZE = 64 * 1024 * 1024;
+
+		/**
+		 * Size of the read-ahead buffer.
+		 */
+		static const size_t READ_BUFFER_SIZE = 16 * 1024;
+
+		/**
+		 * Bytes to take from the send queue for a write.
+		 */
+		static const size_t MAX_WRITE_SIZE = 256 * 1024;
+
+		std::vector<unsigned char> read_buffer;
+		size_t read_first;
+		size_t read_last;
+		std::vector<unsigned char> large_buffer;
+
+		size_t pending_size;
+		unsigned char *pending_destination;
+		size_t pending_completed;
+		std::function<void(unsigned char*)> pending_handler;
+		bool pending_listen_next;
+
+		std::weak_ptr<Communicator> self_weak_ptr;
+
+		/**
+		 * Strand of an {@link asynchronous} communicator. Reads, writes, the flush timer and closing the {@link socket} 
+		 * are all run in it, thus never overlap on the pool.
+		 */
+		std::unique_ptr<boost::asio::strand<boost::asio::ip::tcp::socket::executor_type>> strand;
+
+		std::deque<std::shared_ptr<OutboundMessage>> send_queue;
+		std::vector<std::shared_ptr<OutboundMessage>> sending_messages;
+		std::vector<boost::asio::const_buffer> sending_buffers;
+		std::vector<const std::array<unsigned char, 4>*> sending_masks;
+		size_t sending_size;
+		std::condition_variable send_cv;
+		std::unique_ptr<boost::asio::steady_timer> flush_timer;
+
+		bool writing;
+		size_t queued_bytes;
+		size_t flush_size;
+		std::chrono::microseconds flush_delay;
+
+		std::atomic<size_t> queue_depth_;
+		std::atomic<size_t> bytes_in_flight_;
+
+	public:
+		/**
+		 * Callback function for closed connection.
+		 * 
+		 * The {@link onClose} is called when the connection with the remote system has closed, whether the messages were 
+		 * listened synchronously or {@link ClientDriver.listen asynchronously}. The function is released after being 
+		 * called, thus specify it again before re-connecting.
+		 */
+		std::function<void()> onClose;
+
 	public:
 		Communicator()
 		{
 			listener = nullptr;
+
+			binary_mode = false;
+			binary_mode_requested = false;
+			document_mode = false;
+			compression_threshold = 0;
+			max_message_size = MAX_MESSAGE_SIZE;
+
+			read_first = 0;
+			read_last = 0;
+
+			asynchronous = false;
+			writing = false;
+			sending_size = 0;
+			queued_bytes = 0;
+			flush_size = 0;
+			flush_delay = std::chrono::microseconds(0);
+
+			queue_depth_ = 0;
+			bytes_in_flight_ = 0;
 		};
 		virtual ~Communicator()
 		{
@@ -61,8 +229,174 @@ namespace protocol
 		 */
 		virtual void close()
 		{
-			if (socket != nullptr && socket->is_open())
-				socket->close();
+			if (socket == nullptr)
+				return;
+
+			if (strand == nullptr)
+			{
+				if (socket->is_open())
+					socket->close();
+				return;
+			}
+
+			// IN THE STRAND, NOT TO RACE WITH READS AND WRITES OF THE SOCKET
+			std::shared_ptr<boost::asio::ip::tcp::socket> socket = this->socket;
+			boost::asio::dispatch(*strand, [socket]()
+			{
+				if (socket->is_open())
+					socket->close();
+			});
+		};
+
+		/**
+		 * Request binary mode.
+		 *
+		 * Requests the remote system to exchange {@link Invoke} messages in binary format, 
+		 * {@link Invoke.toByteArray Invoke.toByteArray()}, instead of XML. Parsing and stringifying XML are skipped 
+		 * and {@link ByteArray} parameters are delivered in the same frame.
+		 *
+		 * The request is sent when the connection begins, {@link ServerConnector.connect connect()} or 
+		 * {@link ClientDriver.listen listen()}, thus call this method before them. Binary mode starts only when the 
+		 * remote system answers the request. If the remote system doesn't support the binary mode, it never answers 
+		 * and XML is used as before.
+		 *
+		 * Note that, a web-socket communicator ignores this request. Web-socket peers, often web browsers, 
+		 * understand only XML.
+		 *
+		 * @param flag Whether to request binary mode or not.
+		 */
+		void setBinaryMode(bool flag)
+		{
+			binary_mode_requested = flag;
+		};
+
+		/**
+		 * Test whether binary mode is on.
+		 *
+		 * @return Whether {@link Invoke} messages are sent in binary format.
+		 */
+		auto isBinaryMode() const -> bool
+		{
+			return binary_mode;
+		};
+
+		/**
+		 * Set document mode.
+		 *
+		 * In the document mode, {@link Invoke} messages received in XML are parsed into an 
+		 * {@link library::XMLDocument} instead of an {@link library::XML} object. Nodes of the document are allocated 
+		 * in an arena and refer to the received string without copy, and escaped values are decoded lazily. Parameters 
+		 * of XML type keep their nodes and the document, to be converted into {@link library::XML} objects only when
+		 * they're requested; read them by {@link InvokeParameter.getValueAsNode getValueAsNode()} to skip the 
+		 * conversion. Values of XML type are even not parsed until their nodes are traversed, thus an 
+		 * {@link Entity} can be constructed from {@link InvokeParameter.getValueAsReader getValueAsReader()} in a 
+		 * single pass over the received string. The document is freed at once when the {@link Invoke} message is 
+		 * released.
+		 *
+		 * @param flag Whether to parse messages into documents or not.
+		 */
+		void setDocumentMode(bool flag)
+		{
+			document_mode = flag;
+		};
+
+		/**
+		 * Test whether document mode is on.
+		 *
+		 * @return Whether messages are parsed into {@link library::XMLDocument documents}.
+		 */
+		auto isDocumentMode() const -> bool
+		{
+			return document_mode;
+		};
+
+		/**
+		 * Set threshold of compression.
+		 *
+		 * Frames whose sizes are greater than or equal to the *size* are compressed by zlib before being sent, only if 
+		 * the compressed data are smaller. Compressed frames are marked in their headers and decompressed by the 
+		 * remote system transparently. Compression costs CPU time, thus it pays for large XML messages crossing slow 
+		 * networks; measure the break-even point by the compression benchmark.
+		 *
+		 * The remote system must be a {@link Communicator} understanding the compressed frame, like this one. 
+		 * Compressed frames are accepted only when compression is enabled on the receiving side too, thus set the 
+		 * threshold on both sides. Decompressed contents are limited by the {@link setMaxMessageSize maximum size}.
+		 *
+		 * @param size Minimum size of frames to compress. Zero, the default, disables compression.
+		 */
+		void setCompressionThreshold(size_t size)
+		{
+			compression_threshold = size;
+		};
+
+		/**
+		 * Get threshold of compression.
+		 *
+		 * @return Minimum size of frames to compress. Zero means compression is disabled.
+		 */
+		auto getCompressionThreshold() const -> size_t
+		{
+			return compression_threshold;
+		};
+
+		/**
+		 * Set maximum size of a message to receive.
+		 *
+		 * Sizes of messages are told by the remote system. A message larger than the *size*, whether its frame or its 
+		 * decompressed content, is rejected and the connection is closed, before its data are read. The default is 
+		 * 64 MB.
+		 *
+		 * @param size Maximum size of a message, in bytes.
+		 */
+		void setMaxMessageSize(size_t size)
+		{
+			max_message_size = size;
+		};
+
+		/**
+		 * Get maximum size of a message to receive.
+		 */
+		auto getMaxMessageSize() const -> size_t
+		{
+			return max_message_size;
+		};
+
+		/**
+		 * Set condition of flushing.
+		 *
+		 * Messages {@link sendData sent} are queued and written by a writer, packing several messages into a write.
+		 * By default, the writer flushes the queue as soon as possible. If the *size* and *delay* are specified, the
+		 * writer waits until sum of queued messages reaches the *size* or the *delay* elapses, to pack more messages.
+		 *
+		 * @param size Bytes of queued messages to flush without waiting.
+		 * @param delay Maximum delay to wait for more messages.
+		 */
+		void setFlushCondition(size_t size, std::chrono::microseconds delay)
+		{
+			std::unique_lock<std::mutex> uk(send_mtx);
+
+			flush_size = size;
+			flush_delay = delay;
+		};
+
+		/**
+		 * Get number of messages in the send queue.
+		 *
+		 * @return Number of messages waiting to be written.
+		 */
+		auto getQueueDepth() const -> size_t
+		{
+			return queue_depth_;
+		};
+
+		/**
+		 * Get bytes in flight.
+		 *
+		 * @return Bytes of messages {@link sendData sent}, but not written to the socket yet.
+		 */
+		auto getBytesInFlight() const -> size_t
+		{
+			return bytes_in_flight_;
 		};
 
 		/**
@@ -87,19 +421,14 @@ namespace protocol
 		*
 		* Send the {@link Invoke} message to remote system.
 		*
+		* The message is queued and this method returns without waiting the message to be written, unless this thread 
+		* becomes the writer of a synchronous communicator. Thus, don't modify the *invoke* after sending.
+		*
 		* @param invoke An {@link Invoke} message to send.
 		*/
 		virtual void sendData(std::shared_ptr<Invoke> invoke)
 		{
-			std::unique_lock<std::mutex> uk(send_mtx);
-
-			// SEND INVOKE
-			send_data(invoke->toXML()->toString());
-
-			// SEND BINARY
-			for (size_t i = 0; i < invoke->size(); i++)
-				if (invoke->at(i)->getType() == "ByteArray")
-					send_data(invoke->at(i)->referValue<ByteArray>());
+			send_message(encode_message(invoke));
 		};
 
 	protected:
@@ -112,51 +441,29 @@ namespace protocol
 		--------------------------------------------------------- */
 		virtual void listen_message()
 		{
-			std::shared_ptr<Invoke> binary_invoke = nullptr;
-			std::queue<std::shared_ptr<InvokeParameter>> binary_parameters;
-
 			while (true)
 			{
 				try
 				{
 					// READ CONTENT SIZE
-					size_t content_size = listen_size();
+					std::pair<unsigned char, size_t> header = listen_header();
+					size_t content_size = header.second;
 
 					// READ CONTENT
-					if (binary_invoke == nullptr)
+					if (header.first & COMPRESSED)
+						handle_compressed(header.first, listen_view(content_size), content_size);
+					else if (header.first & BINARY_INVOKE)
 					{
-						std::shared_ptr<Invoke> invoke = listen_string(content_size);
-
-						for (size_t i = 0; i < invoke->size(); i++)
-						{
-							std::shared_ptr<InvokeParameter> &parameter = invoke->at(i);
-							if (parameter->getType() != "ByteArray")
-								continue;
-
-							if (binary_invoke == nullptr)
-								binary_invoke = invoke;
-							binary_parameters.push(parameter);
-						}
-
-						// NO BINARY, THEN REPLY DIRECTLY
-						if (binary_invoke == nullptr)
-							this->replyData(invoke);
+						// BINARY INVOKE HAS ITS BYTE_ARRAYS, REPLY DIRECTLY
+						std::shared_ptr<Invoke> invoke = listen_binary_invoke(content_size);
+						this->replyData(invoke);
 					}
+					else if (binary_invoke == nullptr)
+						handle_string(listen_string(content_size));
 					else
 					{
-						std::shared_ptr<InvokeParameter> parameter = binary_parameters.front();
-						listen_binary(content_size, parameter);
-						binary_parameters.pop();
-
-						if (binary_parameters.empty() == true)
-						{
-							// NO BINARY PARAMETER LEFT,
-							std::shared_ptr<Invoke> invoke = binary_invoke;
-							binary_invoke = nullptr;
-
-							// THEN REPLY
-							this->replyData(invoke);
-						}
+						listen_binary(content_size, binary_parameters.front());
+						handle_binary();
 					}
 				}
 				catch (std::exception &e)
@@ -169,67 +476,961 @@ namespace protocol
 					break;
 				}
 			}
+			handle_close();
+		};
+
+		/**
+		 * Listen messages asynchronously.
+		 * 
+		 * Starts listening messages without blocking. Handlers are called by threads running the *io_service* of the 
+		 * {@link socket}, until the connection closes.
+		 * 
+		 * @param self Shared pointer of this object, keeping it alive during the connection.
+		 */
+		void listen_async(std::shared_ptr<Communicator> self)
+		{
+			set_self(self);
+
+			// MESSAGES QUEUED BEFORE LISTENING
+			{
+				std::unique_lock<std::mutex> uk(send_mtx);
+				if (writing == false && send_queue.empty() == false)
+					flush_async();
+			}
+
+			// READINGS START IN THE STRAND
+			boost::asio::dispatch(*strand, [this, self]()
+			{
+				listen_message_async();
+				read_async(self);
+			});
+		};
+
+		/**
+		 * Specify shared pointer of this object.
+		 *
+		 * Asynchronous writes hold the object alive by it. Specify it before sending any message asynchronously; 
+		 * messages sent before it are kept in the queue until {@link listen_async listen_async()}. The {@link strand} 
+		 * of an {@link asynchronous} communicator is also created here.
+		 *
+		 * @param self Shared pointer of this object.
+		 */
+		void set_self(std::shared_ptr<Communicator> self)
+		{
+			self_weak_ptr = self;
+
+			if (asynchronous == true && strand == nullptr)
+				strand.reset(new boost::asio::strand<boost::asio::ip::tcp::socket::executor_type>(socket->get_executor()));
+		};
+
+		/**
+		 * Reserve reading a message asynchronously.
+		 * 
+		 * Reserves reading the header of a message by {@link listen_view_async listen_view_async()}. The handler reserves 
+		 * reading the content and this method is called again after the message is handled.
+		 */
+		virtual void listen_message_async()
+		{
+			// READ CONTENT SIZE
+			listen_view_async(8, [this](unsigned char *header)
+			{
+				unsigned char flags = header[0];
+				size_t size = parse_header(header);
+
+				// READ CONTENT
+				if (flags & COMPRESSED)
+				{
+					listen_view_async(size, [this, flags, size](unsigned char *data)
+					{
+						handle_compressed(flags, data, size);
+					});
+				}
+				else if (flags & BINARY_INVOKE)
+				{
+					listen_view_async(size, [this, size](unsigned char *data)
+					{
+						this->replyData(construct_binary_invoke(data, size));
+					});
+				}
+				else if (binary_invoke == nullptr)
+				{
+					listen_view_async(size, [this, size](unsigned char *data)
+					{
+						handle_string(construct_invoke(data, size));
+					});
+				}
+				else
+				{
+					ByteArray &data = binary_parameters.front()->borrowByteArray(size);
+
+					listen_data_async(boost::asio::buffer(data), [this]()
+					{
+						handle_binary();
+					});
+				}
+			}, false);
+		};
+
+		/**
+		 * Reserve reading data asynchronously.
+		 * 
+		 * @param buffer Buffer to fill.
+		 * @param handler Handler called after the *buffer* is filled.
+		 * @param listen_next Whether to {@link listen_message_async listen the next message} after the *handler*.
+		 */
+		void listen_data_async(boost::asio::mutable_buffer buffer, std::function<void()> handler, bool listen_next = true)
+		{
+			pending_size = boost::asio::buffer_size(buffer);
+			pending_destination = boost::asio::buffer_cast<unsigned char*>(buffer);
+			pending_completed = 0;
+			pending_listen_next = listen_next;
+			pending_handler = [handler](unsigned char*)
+			{
+				handler();
+			};
+		};
+
+		/**
+		 * Reserve reading data asynchronously, without copy.
+		 * 
+		 * The *handler* receives a pointer to the {@link read_buffer read-ahead buffer}, which is valid only in the 
+		 * *handler*. Data larger than the read-ahead buffer are delivered through a temporary buffer.
+		 * 
+		 * @param size Size of data to read.
+		 * @param handler Handler receiving the data.
+		 * @param listen_next Whether to {@link listen_message_async listen the next message} after the *handler*.
+		 */
+		void listen_view_async(size_t size, std::function<void(unsigned char*)> handler, bool listen_next = true)
+		{
+			pending_size = size;
+			pending_destination = nullptr;
+			pending_completed = 0;
+			pending_listen_next = listen_next;
+			pending_handler = handler;
+		};
+
+		/**
+		 * Handle an {@link Invoke} message constructed from string.
+		 * 
+		 * If the *invoke* has {@link ByteArray} parameters, their binary data follows. In that case, replying the 
+		 * *invoke* is postponed until the binary data are all read.
+		 */
+		void handle_string(std::shared_ptr<Invoke> invoke)
+		{
+			for (size_t i = 0; i < invoke->size(); i++)
+			{
+				std::shared_ptr<InvokeParameter> &parameter = invoke->at(i);
+				if (parameter->getTypeCode() != InvokeParameter::BYTE_ARRAY)
+					continue;
+
+				if (binary_invoke == nullptr)
+					binary_invoke = invoke;
+				binary_parameters.push(parameter);
+			}
+
+			// NO BINARY, THEN REPLY DIRECTLY
+			if (binary_invoke == nullptr)
+			{
+				if (invoke->getListener() == "_Binary_mode")
+					accept_binary_mode();
+				else
+					this->replyData(invoke);
+			}
+		};
+
+		/**
+		 * Handle binary data of a {@link ByteArray} parameter, which has been read.
+		 */
+		void handle_binary()
+		{
+			binary_parameters.pop();
+
+			if (binary_parameters.empty() == true)
+			{
+				// NO BINARY PARAMETER LEFT,
+				std::shared_ptr<Invoke> invoke = binary_invoke;
+				binary_invoke = nullptr;
+
+				// THEN REPLY
+				this->replyData(invoke);
+			}
+		};
+
+		/**
+		 * Handle a compressed frame.
+		 *
+		 * Decompresses the frame and handles it as an uncompressed frame with the same *flags*.
+		 */
+		void handle_compressed(unsigned char flags, const unsigned char *data, size_t size)
+		{
+			if (compression_threshold == 0)
+				throw std::domain_error("compressed frame has delivered while compression is disabled.");
+
+			ByteArray content = ByteArray::decompress(data, size, max_message_size);
+
+			if (flags & BINARY_INVOKE)
+				this->replyData(construct_binary_invoke(content.data(), content.size()));
+			else if (binary_invoke == nullptr)
+				handle_string(construct_invoke(content.data(), content.size()));
+			else
+			{
+				ByteArray &byte_array = binary_parameters.front()->borrowByteArray(content.size());
+				memcpy(byte_array.data(), content.data(), content.size());
+
+				handle_binary();
+			}
+		};
+
+		/**
+		 * Handle closed connection, by calling {@link onClose}.
+		 */
+		void handle_close()
+		{
+			// RELEASE THE HANDLER, IT MAY HOLD THIS OBJECT
+			std::function<void()> handler = onClose;
+			onClose = nullptr;
+
+			binary_invoke = nullptr;
+			binary_parameters = std::queue<std::shared_ptr<InvokeParameter>>();
+
+			if (handler)
+				handler();
+		};
+
+		auto has_binary_parameter() const -> bool
+		{
+			return binary_invoke != nullptr;
+		};
+
+		auto front_binary_parameter() const -> std::shared_ptr<InvokeParameter>
+		{
+			return binary_parameters.front();
+		};
+
+		/**
+		 * Send request of binary mode, if {@link setBinaryMode requested}.
+		 */
+		virtual void request_binary_mode()
+		{
+			if (binary_mode_requested == true && binary_mode == false)
+				sendData(std::make_shared<Invoke>("_Binary_mode"));
+		};
+
+		auto construct_invoke(const unsigned char *data, size_t size) const -> std::shared_ptr<Invoke>
+		{
+			WeakString str((const char*)data, size);
+			std::shared_ptr<Invoke> invoke(new Invoke());
+
+			if (document_mode == true)
+			{
+				// THE DOCUMENT RETAINS A COPY OF THE BUFFER, NODES REFER TO IT
+				// VALUES OF PARAMETERS, DEEPER THAN 2 LEVELS, ARE FOLDED
+				invoke->construct(std::make_shared<library::XMLDocument>(str, 2));
+			}
+			else
+			{
+				// PARSE XML DIRECTLY FROM THE BUFFER
+				invoke->construct(std::make_shared<library::XML>(str));
+			}
+			return invoke;
+		};
+
+		/* ---------------------------------------------------------
+			READ-AHEAD BUFFER
+		--------------------------------------------------------- */
+		/**
+		 * Read data.
+		 * 
+		 * Data are taken from the {@link read_buffer read-ahead buffer} first. Small data are read through the buffer, 
+		 * pulling as many bytes as the socket has, thus following messages can be read without system call. Large 
+		 * data are read directly into the *data*.
+		 * 
+		 * @param data Container to fill.
+		 */
+		template <class Container>
+		void listen_data(Container &data)
+		{
+			listen_data((unsigned char*)data.data(), data.size());
+		};
+
+		/**
+		 * Read data.
+		 * 
+		 * @param destination Pointer to fill.
+		 * @param size Size of data to read.
+		 */
+		void listen_data(unsigned char *destination, size_t size)
+		{
+			size_t completed = consume_buffer(destination, size);
+
+			if (size - completed >= READ_BUFFER_SIZE)
+			{
+				// LARGE DATA, READ DIRECTLY
+				boost::asio::read(*socket, boost::asio::buffer(destination + completed, size - completed));
+				return;
+			}
+
+			while (completed < size)
+			{
+				fill_buffer();
+				completed += consume_buffer(destination + completed, size - completed);
+			}
+		};
+
+		/**
+		 * Read data without copy.
+		 * 
+		 * @param size Size of data to read.
+		 * @return Pointer to the data in the {@link read_buffer read-ahead buffer}, valid until the next reading.
+		 */
+		auto listen_view(size_t size) -> unsigned char*
+		{
+			if (size > READ_BUFFER_SIZE)
+			{
+				// LARGER THAN THE BUFFER
+				if (size > max_message_size)
+					throw std::length_error("too large message has delivered.");
+
+				large_buffer.resize(size);
+				listen_data(large_buffer);
+
+				return large_buffer.data();
+			}
+
+			while (read_last - read_first < size)
+				fill_buffer();
+
+			unsigned char *data = read_buffer.data() + read_first;
+			read_first += size;
+
+			return data;
 		};
 
 	private:
-		auto listen_size() -> size_t
+		void accept_binary_mode()
+		{
+			if (binary_mode == true)
+				return;
+
+			// ANSWER, IF THE REQUEST HAS COME FROM THE REMOTE SYSTEM
+			if (binary_mode_requested == false)
+				sendData(std::make_shared<Invoke>("_Binary_mode"));
+
+			binary_mode = true;
+		};
+
+		auto listen_header() -> std::pair<unsigned char, size_t>
 		{
-			std::array<unsigned char, 8> size_header;
-			listen_data(size_header);
+			unsigned char *header = listen_view(8);
+
+			return{ header[0], parse_header(header) };
+		};
 
+		auto parse_header(const unsigned char *header) const -> size_t
+		{
+			// FIRST BYTE IS FOR FLAGS, LEFT 7 BYTES ARE FOR SIZE
 			size_t size = 0;
-			for (size_t c = 0; c < size_header.size(); c++)
-				size += size_header[c] << (8 * (size_header.size() - 1 - c));
+			for (size_t c = 1; c < 8; c++)
+				size = (size << 8) | header[c];
+
+			// THE SIZE IS TOLD BY THE REMOTE SYSTEM
+			if (size > max_message_size)
+				throw std::length_error("too large message has delivered.");
 
 			return size;
 		};
 
+		auto listen_binary_invoke(size_t size) -> std::shared_ptr<Invoke>
+		{
+			return construct_binary_invoke(listen_view(size), size);
+		};
+
 		auto listen_string(size_t size) -> std::shared_ptr<Invoke>
 		{
+			return construct_invoke(listen_view(size), size);
+		};
+
+		void listen_binary(size_t size, std::shared_ptr<InvokeParameter> parameter)
+		{
+			// FETCH BYTE_ARRAY
+			ByteArray &data = parameter->borrowByteArray(size);
+
 			// READ CONTENT
-			std::string data(size, (char)NULL);
 			listen_data(data);
+		};
+
+		static auto construct_binary_invoke(const unsigned char *data, size_t size) -> std::shared_ptr<Invoke>
+		{
+			ByteArray byte_array;
+			byte_array.assign(data, data + size);
 
-			// CONSTRUCT INVOKE OBJECT
 			std::shared_ptr<Invoke> invoke(new Invoke());
-			invoke->construct(std::make_shared<library::XML>(data));
+			invoke->construct(byte_array);
 
 			return invoke;
 		};
 
-		void listen_binary(size_t size, std::shared_ptr<InvokeParameter> parameter)
+		auto consume_buffer(unsigned char *destination, size_t size) -> size_t
 		{
-			// FETCH BYTE_ARRAY
-			ByteArray &data = (ByteArray&)parameter->referValue<ByteArray>();
-			data.assign(size, NULL);
+			size_t piece_size = std::min(size, read_last - read_first);
+			if (piece_size == 0)
+				return 0;
 
-			// READ CONTENT
-			listen_data(data);
+			memcpy(destination, read_buffer.data() + read_first, piece_size);
+			read_first += piece_size;
+
+			return piece_size;
 		};
 
-		template <class Container>
-		void listen_data(Container &data)
+		void compact_buffer()
 		{
-			size_t completed = 0;
+			if (read_buffer.empty() == true)
+				read_buffer.resize(READ_BUFFER_SIZE);
 
-			while (completed < data.size())
+			// MOVE LEFT BYTES TO THE FRONT
+			if (read_first != 0)
 			{
-				size_t piece_size = socket->read_some(boost::asio::buffer((unsigned char*)data.data() + completed, data.size() - completed));
-				completed += piece_size;
+				memmove(read_buffer.data(), read_buffer.data() + read_first, read_last - read_first);
+				read_last -= read_first;
+				read_first = 0;
 			}
 		};
 
+		void fill_buffer()
+		{
+			compact_buffer();
+
+			// READ AS MANY BYTES AS THE SOCKET HAS
+			read_last += socket->read_some(boost::asio::buffer(read_buffer.data() + read_last, read_buffer.size() - read_last));
+		};
+
+		void read_async(std::shared_ptr<Communicator> self)
+		{
+			// HANDLE RESERVED READINGS, UNTIL DATA IN THE BUFFER ARE EXHAUSTED
+			while (pending_handler != nullptr)
+			{
+				unsigned char *data;
+
+				if (pending_destination == nullptr && pending_size > READ_BUFFER_SIZE)
+				{
+					// LARGER THAN THE BUFFER
+					large_buffer.resize(pending_size);
+					pending_destination = large_buffer.data();
+				}
+
+				if (pending_destination != nullptr)
+				{
+					pending_completed += consume_buffer(pending_destination + pending_completed, pending_size - pending_completed);
+					if (pending_completed < pending_size)
+					{
+						if (pending_size - pending_completed >= READ_BUFFER_SIZE)
+						{
+							// LARGE DATA, READ DIRECTLY
+							boost::asio::async_read
+							(
+								*socket, 
+								boost::asio::buffer(pending_destination + pending_completed, pending_size - pending_completed), 
+								boost::asio::bind_executor(*strand, [this, self](const boost::system::error_code &error, size_t size)
+								{
+									if (error)
+									{
+										handle_close();
+										return;
+									}
+									pending_completed += size;
+									read_async(self);
+								})
+							);
+						}
+						else
+							fill_buffer_async(self);
+						return;
+					}
+					data = pending_destination;
+				}
+				else
+				{
+					if (read_last - read_first < pending_size)
+					{
+						fill_buffer_async(self);
+						return;
+					}
+
+					data = read_buffer.data() + read_first;
+					read_first += pending_size;
+				}
+
+				// RELEASE THE RESERVATION AND CALL ITS HANDLER
+				std::function<void(unsigned char*)> handler = std::move(pending_handler);
+				bool listen_next = pending_listen_next;
+				pending_handler = nullptr;
+
+				try
+				{
+					handler(data);
+				}
+				catch (std::exception &e)
+				{
+					std::cout << "Reason of disconnection: " << e.what() << std::endl;
+
+					close();
+					handle_close();
+					return;
+				}
+
+				if (listen_next == true)
+					listen_message_async();
+			}
+		};
+
+		void fill_buffer_async(std::shared_ptr<Communicator> self)
+		{
+			compact_buffer();
+
+			// READ AS MANY BYTES AS THE SOCKET HAS
+			socket->async_read_some
+			(
+				boost::asio::buffer(read_buffer.data() + read_last, read_buffer.size() - read_last), 
+				boost::asio::bind_executor(*strand, [this, self](const boost::system::error_code &error, size_t size)
+				{
+					if (error)
+					{
+						handle_close();
+						return;
+					}
+					read_last += size;
+					read_async(self);
+				})
+			);
+		};
+
+	protected:
 		/* ---------------------------------------------------------
 			SEND
 		--------------------------------------------------------- */
+		/**
+		 * Encode an {@link Invoke} message to frames.
+		 *
+		 * If an {@link InvokeFrame} is attached to the *invoke*, frames are encoded once and shared by all the peers
+		 * of the broadcast. With compression, only the text or binary data are shared.
+		 *
+		 * @param invoke An {@link Invoke} message to encode.
+		 * @return The encoded message.
+		 */
+		virtual auto encode_message(std::shared_ptr<Invoke> invoke) -> std::shared_ptr<OutboundMessage>
+		{
+			std::shared_ptr<InvokeFrame> frame = invoke->_Get_frame();
+
+			// THE MODE CAN BE CHANGED BY THE LISTENER, WHILE ENCODING
+			bool binary = binary_mode;
+
+			if (frame != nullptr && compression_threshold == 0)
+			{
+				InvokeFrame::Encoding encoding = binary ? InvokeFrame::BINARY_FRAME : InvokeFrame::FRAME;
+				return share_message(invoke, frame->fetch<OutboundMessage>(encoding, [this, &invoke, binary]() -> std::shared_ptr<OutboundMessage>
+				{
+					std::shared_ptr<OutboundMessage> prototype = encode_frames(invoke, binary);
+					prototype->invoke = nullptr; // THE INVOKE HOLDS THE FRAME
+
+					return prototype;
+				}));
+			}
+			return encode_frames(invoke, binary);
+		};
+
+		/**
+		 * Encode an {@link Invoke} message to frames of this communicator.
+		 *
+		 * @param invoke An {@link Invoke} message to encode.
+		 * @param binary Whether to encode in binary.
+		 * @return The encoded message.
+		 */
+		auto encode_frames(std::shared_ptr<Invoke> invoke, bool binary) -> std::shared_ptr<OutboundMessage>
+		{
+			std::shared_ptr<OutboundMessage> message(new OutboundMessage());
+			message->invoke = invoke;
+
+			// ENCODE INVOKE IN BINARY, BYTE_ARRAYS ARE CONTAINED
+			if (binary == true)
+			{
+				write_binary(invoke, message->body);
+				message->headers.resize(1);
+				if (compression_threshold != 0)
+					message->compressed_bodies.resize(1);
+
+				gather_frame(*message, 0, message->body, BINARY_INVOKE);
+				return message;
+			}
+
+			// COUNT FRAMES; INVOKE AND ITS BINARIES
+			write_text(invoke, message->text);
+			size_t count = 1;
+
+			for (size_t i = 0; i < invoke->size(); i++)
+				if (invoke->at(i)->getTypeCode() == InvokeParameter::BYTE_ARRAY)
+					count++;
+
+			// GATHER THEM
+			message->headers.resize(count);
+			if (compression_threshold != 0)
+				message->compressed_bodies.resize(count);
+
+			gather_frame(*message, 0, message->text);
+
+			for (size_t i = 0, index = 1; i < invoke->size(); i++)
+				if (invoke->at(i)->getTypeCode() == InvokeParameter::BYTE_ARRAY)
+					gather_frame(*message, index++, invoke->at(i)->referValue<ByteArray>());
+
+			return message;
+		};
+
+		/**
+		 * Write an {@link Invoke} message in XML, once for all the peers of a broadcast.
+		 */
+		static void write_text(const std::shared_ptr<Invoke> &invoke, std::string &text)
+		{
+			std::shared_ptr<InvokeFrame> frame = invoke->_Get_frame();
+			if (frame == nullptr)
+			{
+				invoke->toXML()->write(text, true);
+				return;
+			}
+
+			text = *frame->fetch<std::string>(InvokeFrame::TEXT, [&invoke]() -> std::shared_ptr<std::string>
+			{
+				std::shared_ptr<std::string> text(new std::string());
+				invoke->toXML()->write(*text, true);
+
+				return text;
+			});
+		};
+
+		/**
+		 * Write an {@link Invoke} message in binary, once for all the peers of a broadcast.
+		 */
+		static void write_binary(const std::shared_ptr<Invoke> &invoke, ByteArray &data)
+		{
+			std::shared_ptr<InvokeFrame> frame = invoke->_Get_frame();
+			if (frame == nullptr)
+			{
+				data = invoke->toByteArray();
+				return;
+			}
+
+			data = *frame->fetch<ByteArray>(InvokeFrame::BINARY, [&invoke]() -> std::shared_ptr<ByteArray>
+			{
+				return std::make_shared<ByteArray>(invoke->toByteArray());
+			});
+		};
+
+		/**
+		 * Create a message writing from buffers of a shared *prototype*.
+		 */
+		static auto share_message(std::shared_ptr<Invoke> invoke, std::shared_ptr<const OutboundMessage> prototype) -> std::shared_ptr<OutboundMessage>
+		{
+			std::shared_ptr<OutboundMessage> message(new OutboundMessage());
+			message->invoke = invoke;
+			message->shared = prototype;
+
+			message->buffers = prototype->buffers;
+			message->boundaries = prototype->boundaries;
+			message->size = prototype->size;
+
+			return message;
+		};
+
+		/**
+		 * Send an encoded message.
+		 *
+		 * Enqueues the *message* to the send queue. If no writer is working, a writer starts to flush the queue; an
+		 * asynchronous write for an {@link asynchronous} communicator, otherwise the current thread becomes the writer
+		 * and writes messages queued by all threads.
+		 *
+		 * @param message An encoded message to send.
+		 */
+		void send_message(std::shared_ptr<OutboundMessage> message)
+		{
+			std::unique_lock<std::mutex> uk(send_mtx);
+
+			// ENQUEUE
+			prepare_message(*message);
+			if (message->urgent == true)
+				send_queue.push_front(message);
+			else
+				send_queue.push_back(message);
+			queued_bytes += message->size;
+
+			queue_depth_++;
+			bytes_in_flight_ += message->size;
+
+			if (writing == true)
+			{
+				// THE WRITER WILL TAKE IT
+				if (queued_bytes >= flush_size || message->urgent == true)
+					send_cv.notify_one();
+				return;
+			}
+
+			if (asynchronous == true)
+			{
+				if (queued_bytes >= flush_size || flush_delay.count() == 0 || message->urgent == true)
+					flush_async();
+				else if (flush_timer == nullptr)
+					wait_flush_async();
+				return;
+			}
+
+			// THIS THREAD BECOMES THE WRITER
+			writing = true;
+
+			if (queued_bytes < flush_size && flush_delay.count() != 0)
+				send_cv.wait_for(uk, flush_delay, [this]() -> bool
+				{
+					return queued_bytes >= flush_size || send_queue.front()->urgent == true;
+				});
+
+			try
+			{
+				while (send_queue.empty() == false)
+				{
+					take_messages();
+
+					uk.unlock();
+					write_messages(sending_buffers, sending_masks);
+					uk.lock();
+
+					complete_messages();
+				}
+			}
+			catch (...)
+			{
+				if (uk.owns_lock() == false)
+					uk.lock();
+
+				complete_messages();
+				discard_messages();
+
+				writing = false;
+				throw;
+			}
+			writing = false;
+		};
+
+		/**
+		 * Write messages taken from the send queue, by the writer of a synchronous communicator.
+		 *
+		 * @param buffers Buffers of the messages, in order.
+		 * @param masks Masking keys of the *buffers*, *nullptr* for buffers not to be masked.
+		 */
+		virtual void write_messages(const std::vector<boost::asio::const_buffer> &buffers, const std::vector<const std::array<unsigned char, 4>*> &masks)
+		{
+			// A GATHERING WRITE, UNTIL ALL BYTES ARE SENT
+			boost::asio::write(*socket, buffers);
+		};
+
+		/**
+		 * Prepare a message right before being enqueued.
+		 *
+		 * Called in order of sending, with the {@link send_mtx} locked. Override it when encoding depends on previous
+		 * messages.
+		 *
+		 * @param message A message {@link encode_message encoded}.
+		 */
+		virtual void prepare_message(OutboundMessage &message)
+		{
+		};
+
 		template <class Container>
-		void send_data(const Container &data)
+		void gather_frame(OutboundMessage &message, size_t index, const Container &data, unsigned char flags = 0)
 		{
-			ByteArray header;
-			header.writeReversely((unsigned long long)data.size());
+			if (compression_threshold != 0 && data.size() >= compression_threshold)
+			{
+				ByteArray &compressed = message.compressed_bodies[index];
+				compressed = ByteArray::compress((const unsigned char*)data.data(), data.size());
+
+				// SEND COMPRESSED DATA ONLY IF IT'S SMALLER
+				if (compressed.size() < data.size())
+				{
+					gather_header(message, index, compressed.size(), flags | COMPRESSED);
+					message.buffers.push_back(boost::asio::buffer(compressed));
+					return;
+				}
+			}
+
+			gather_header(message, index, data.size(), flags);
+			message.buffers.push_back(boost::asio::buffer(data));
+		};
+
+		static void gather_header(OutboundMessage &message, size_t index, size_t data_size, unsigned char flags)
+		{
+			// FIRST BYTE IS FOR FLAGS, LEFT 7 BYTES ARE FOR SIZE
+			std::array<unsigned char, 14> &header = message.headers[index];
+			unsigned long long size = (unsigned long long)data_size;
+
+			for (size_t c = 7; c > 0; c--)
+			{
+				header[c] = (unsigned char)(size & 0xFF);
+				size >>= 8;
+			}
+			header[0] = flags;
+
+			message.buffers.push_back(boost::asio::buffer(header.data(), 8));
+			message.size += 8 + data_size;
+		};
+
+	private:
+		/**
+		 * Move queued messages to the writing buffers. The {@link send_mtx} must be locked.
+		 *
+		 * About {@link MAX_WRITE_SIZE} bytes are taken at once. A large message is taken by parts, at its 
+		 * {@link OutboundMessage.boundaries boundaries}, so that urgent messages can be written between the parts.
+		 */
+		void take_messages()
+		{
+			sending_buffers.clear();
+			sending_masks.clear();
+			sending_size = 0;
+
+			while (send_queue.empty() == false && sending_size < MAX_WRITE_SIZE)
+			{
+				std::shared_ptr<OutboundMessage> message = send_queue.front();
+				std::vector<size_t> &boundaries = message->boundaries;
+
+				size_t b = std::upper_bound(boundaries.begin(), boundaries.end(), message->progress) - boundaries.begin();
+				size_t m = 0;
+				size_t i = message->progress;
+				size_t size = 0;
+
+				while (i < message->buffers.size())
+				{
+					const boost::asio::const_buffer &buffer = message->buffers[i];
+					size += boost::asio::buffer_size(buffer);
+
+					// MASKING KEY OF THE BUFFER
+					while (m < message->masks.size() && message->masks[m].first < i)
+						m++;
+					if (m < message->masks.size() && message->masks[m].first == i)
+						sending_masks.push_back(&message->masks[m].second);
+					else
+						sending_masks.push_back(nullptr);
+
+					sending_buffers.push_back(buffer);
+					i++;
+
+					// STOP AT A BOUNDARY, IF ENOUGH
+					if (b < boundaries.size() && boundaries[b] == i)
+					{
+						b++;
+						if (sending_size + size >= MAX_WRITE_SIZE)
+							break;
+					}
+				}
+
+				message->progress = i;
+				message->taken += size;
+				sending_size += size;
+				sending_messages.push_back(message);
+
+				if (i < message->buffers.size())
+					break; // LEFT PARTS ARE TAKEN LATER
+
+				queue_depth_--;
+				send_queue.pop_front();
+			}
+			queued_bytes -= sending_size;
+		};
+
+		/**
+		 * Release messages written. The {@link send_mtx} must be locked.
+		 *
+		 * If a {@link OutboundMessage.closing closing} message has been written, the connection is closed.
+		 */
+		void complete_messages()
+		{
+			bytes_in_flight_ -= sending_size;
+			sending_size = 0;
+
+			bool closing = false;
+			for (size_t i = 0; i < sending_messages.size(); i++)
+				if (sending_messages[i]->closing == true && sending_messages[i]->progress == sending_messages[i]->buffers.size())
+					closing = true;
+
+			sending_messages.clear();
+			sending_buffers.clear();
+			sending_masks.clear();
+
+			// A CLOSING MESSAGE HAS BEEN WRITTEN, NOTHING CAN FOLLOW IT
+			if (closing == true)
+			{
+				discard_messages();
+				close();
+			}
+		};
+
+		/**
+		 * Discard queued messages, when the connection has broken. The {@link send_mtx} must be locked.
+		 */
+		void discard_messages()
+		{
+			for (size_t i = 0; i < send_queue.size(); i++)
+				bytes_in_flight_ -= send_queue[i]->size - send_queue[i]->taken;
+
+			queue_depth_ -= send_queue.size();
+			queued_bytes = 0;
+			send_queue.clear();
+		};
+
+		/**
+		 * Write queued messages asynchronously. The {@link send_mtx} must be locked.
+		 */
+		void flush_async()
+		{
+			std::shared_ptr<Communicator> self = self_weak_ptr.lock();
+			if (self == nullptr)
+				return;
+
+			writing = true;
+			take_messages();
+
+			// THE SENDING BUFFERS ARE KEPT UNTIL THE WRITE COMPLETES; INITIATED IN THE STRAND, WITH READINGS
+			boost::asio::dispatch(*strand, [this, self]()
+			{
+				boost::asio::async_write(*socket, sending_buffers, boost::asio::bind_executor(*strand, [this, self](const boost::system::error_code &error, size_t)
+				{
+					std::unique_lock<std::mutex> uk(send_mtx);
+					complete_messages();
+
+					if (error)
+						discard_messages();
+
+					// MESSAGES QUEUED DURING THE WRITE ARE PACKED AT ONCE
+					if (send_queue.empty() == false)
+						flush_async();
+					else
+						writing = false;
+				}));
+			});
+		};
+
+		/**
+		 * Wait for more messages, until the flush delay elapses. The {@link send_mtx} must be locked.
+		 */
+		void wait_flush_async()
+		{
+			std::shared_ptr<Communicator> self = self_weak_ptr.lock();
+			if (self == nullptr)
+				return;
+
+			// THE HANDLER IS CALLED IN THE STRAND
+			flush_timer.reset(new boost::asio::steady_timer(*strand, flush_delay));
+			flush_timer->async_wait([this, self](const boost::system::error_code &)
+			{
+				std::unique_lock<std::mutex> uk(send_mtx);
+				flush_timer.reset();
 
-			socket->write_some(boost::asio::buffer(header));
-			socket->write_some(boost::asio::buffer(data));
+				if (writing == false && send_queue.empty() == false)
+					flush_async();
+			});
 		};
 	};
 };
@@ -4,6 +4,8 @@
 #include <memory>
 
 #include <samchon/library/XML.hpp>
+#include <samchon/library/XMLReader.hpp>
+#include <samchon/protocol/EntityArchive.hpp>
 
 namespace samchon
 {
@@ -23,9 +25,66 @@ namespace protocol
 		 * <p> By recommended guidance, data representing member variables are contained in properties
 		 * of the put XML object. </p>
 		 *
+		 * <p> By default, loads fields declared by archive() from properties of the XML. </p>
+		 *
 		 * @param xml An xml used to construct data of entity
 		 */
-		virtual void construct(std::shared_ptr<library::XML>) = 0;
+		virtual void construct(std::shared_ptr<library::XML> xml)
+		{
+			EntityArchive archive(EntityArchive::LOAD, *xml);
+			this->archive(archive);
+		};
+
+		/**
+		 * @brief Construct data of the Entity from an XML reader
+		 *
+		 * @details
+		 * <p> The <i>reader</i> is on the start tag of the Entity, and must be left on its end tag. Properties can
+		 * be read on both of them. Override it to fetch data of member variables from the token stream, without 
+		 * building an XML object. </p>
+		 *
+		 * <p> By default, an XML object of the element is built by library::XMLReader::readElement() and passed
+		 * to construct(). </p>
+		 *
+		 * @param reader A reader on the start tag of the entity
+		 */
+		virtual void construct(library::XMLReader &reader)
+		{
+			construct(reader.readElement());
+		};
+
+		/**
+		 * @brief Construct data of the Entity from binary data
+		 *
+		 * @details
+		 * <p> Binary data is read from current {@link ByteArray::get_position position} of the <i>data</i>, and 
+		 * the position is moved to the end of the Entity. By default, loads fields declared by archive(). </p>
+		 *
+		 * @param data Binary data written by toByteArray().
+		 * @throw std::out_of_range The data is truncated.
+		 */
+		virtual void construct(const ByteArray &data)
+		{
+			EntityArchive archive(EntityArchive::LOAD, (ByteArray&)data);
+			this->archive(archive);
+		};
+
+		/**
+		 * @brief Declare member variables
+		 *
+		 * @details
+		 * <p> Declares member variables by EntityArchive::field(), in a fixed order. The declaration is used both
+		 * to save and to load the variables; by default, construct() and toXML() archive them into properties of
+		 * XML and construct(const ByteArray&) and toByteArray() into binary data. Thus overriding archive() is 
+		 * enough to get both forms of the Entity. </p>
+		 *
+		 * <p> Call archive() of the super class first, when overriding it in a derived class. </p>
+		 *
+		 * @param archive An archive to save member variables to, or to load them from.
+		 */
+		virtual void archive(EntityArchive &archive)
+		{
+		};
 
 		/**
 		 * @brief A tag name when represented by XML
@@ -78,8 +137,43 @@ namespace protocol
 			auto xml = std::make_shared<library::XML>();
 			xml->setTag(this->TAG());
 
+			EntityArchive archive(EntityArchive::SAVE, *xml);
+			((EntityBase*)this)->archive(archive);
+
 			return xml;
 		};
+
+		/**
+		 * @brief Get binary data represents the Entity
+		 *
+		 * @details
+		 * <p> Returns binary data, a compact and exact alternative of toXML(), which can be restored by 
+		 * construct(const ByteArray&). An Entity can be sent as a ByteArray parameter of an Invoke message. </p>
+		 *
+		 * @return Binary data represents the Entity.
+		 */
+		auto toByteArray() const -> ByteArray
+		{
+			ByteArray data;
+			writeByteArray(data);
+
+			return data;
+		};
+
+		/**
+		 * @brief Write binary data represents the Entity
+		 *
+		 * @details
+		 * <p> Appends binary data represents the Entity to the <i>data</i>. By default, saves fields declared by
+		 * archive(). </p>
+		 *
+		 * @param data Binary data to write on.
+		 */
+		virtual void writeByteArray(ByteArray &data) const
+		{
+			EntityArchive archive(EntityArchive::SAVE, data);
+			((EntityBase*)this)->archive(archive);
+		};
 	};
 
 	/**
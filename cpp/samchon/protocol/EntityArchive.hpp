@@ -0,0 +1,261 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+#include <samchon/ByteArray.hpp>
+#include <samchon/library/XML.hpp>
+#include <samchon/library/XMLReader.hpp>
+
+namespace samchon
+{
+namespace protocol
+{
+	/**
+	 * An archive of member variables of an {@link Entity}.
+	 *
+	 * {@link EntityArchive} is passed to {@link EntityBase.archive EntityBase.archive()}, where member variables
+	 * of an {@link Entity} are declared once by {@link field field()}. Depending on the archive, the declaration
+	 * saves the variables to, or loads them from:
+	 *
+	 *	- properties of an {@link library::XML} object,
+	 *	- properties of an element read by an {@link library::XMLReader},
+	 *	- or binary data in a {@link ByteArray}.
+	 *
+	 * In binary data, names of the fields are not written; values are written in order of their declarations.
+	 * Numbers are written in 8 bytes of network byte order, thus they're restored exactly, unlike XML. Strings are
+	 * prefixed by their length.
+	 *
+	 * ```cpp
+	 * virtual void archive(EntityArchive &archive) override
+	 * {
+	 *	archive.field("uid", uid);
+	 *	archive.field("longitude", longitude);
+	 *	archive.field("latitude", latitude);
+	 * };
+	 * ```
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class EntityArchive
+	{
+	public:
+		/**
+		 * Direction of an archive.
+		 */
+		enum Mode : unsigned char
+		{
+			SAVE = 0,
+			LOAD = 1
+		};
+
+	private:
+		enum Format : unsigned char
+		{
+			FORMAT_XML = 0,
+			FORMAT_READER = 1,
+			FORMAT_BINARY = 2
+		};
+
+		Mode mode_;
+		Format format_;
+
+		library::XML *xml_;
+		library::XMLReader *reader_;
+		ByteArray *data_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from an XML object.
+		 *
+		 * @param mode Whether to save fields to properties of the *xml* or to load them.
+		 * @param xml An XML object represents the {@link Entity}.
+		 */
+		EntityArchive(Mode mode, library::XML &xml)
+		{
+			mode_ = mode;
+			format_ = FORMAT_XML;
+
+			xml_ = &xml;
+			reader_ = nullptr;
+			data_ = nullptr;
+		};
+
+		/**
+		 * Construct from an XML reader, to load fields.
+		 *
+		 * @param reader A reader on a tag of the {@link Entity}.
+		 */
+		EntityArchive(library::XMLReader &reader)
+		{
+			mode_ = LOAD;
+			format_ = FORMAT_READER;
+
+			xml_ = nullptr;
+			reader_ = &reader;
+			data_ = nullptr;
+		};
+
+		/**
+		 * Construct from binary data.
+		 *
+		 * Fields are appended to the *data* to save, and read from current
+		 * {@link ByteArray.get_position position} of the *data* to load.
+		 *
+		 * @param mode Whether to save fields to the *data* or to load them.
+		 * @param data Binary data.
+		 */
+		EntityArchive(Mode mode, ByteArray &data)
+		{
+			mode_ = mode;
+			format_ = FORMAT_BINARY;
+
+			xml_ = nullptr;
+			reader_ = nullptr;
+			data_ = &data;
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Get mode, whether fields are saved or loaded.
+		 */
+		auto getMode() const -> Mode
+		{
+			return mode_;
+		};
+
+		/**
+		 * Test whether the archive is binary data.
+		 */
+		auto isBinary() const -> bool
+		{
+			return format_ == FORMAT_BINARY;
+		};
+
+		/* ---------------------------------------------------------
+			FIELDS
+		--------------------------------------------------------- */
+		/**
+		 * Declare a field of number.
+		 *
+		 * When loading from XML, a field whose property does not exist is left as it is.
+		 *
+		 * @param name Name of the property in XML.
+		 * @param value Reference of the member variable.
+		 * @throw std::out_of_range Binary data is truncated.
+		 */
+		template <typename T>
+		void field(const std::string &name, T &value)
+		{
+			static_assert(std::is_arithmetic<T>::value, "a field must be a number, bool or std::string.");
+
+			// EVERY NUMBER IS WRITTEN IN 8 BYTES
+			typedef typename std::conditional
+				<
+					std::is_floating_point<T>::value, double,
+					typename std::conditional<std::is_signed<T>::value, long long, unsigned long long>::type
+				>::type binary_type;
+
+			if (format_ == FORMAT_BINARY)
+			{
+				if (mode_ == SAVE)
+					data_->writeReversely((binary_type)value);
+				else
+				{
+					check_size(sizeof(binary_type));
+					value = (T)data_->readReversely<binary_type>();
+				}
+			}
+			else if (mode_ == SAVE)
+				xml_->setProperty(name, value);
+			else if (format_ == FORMAT_XML)
+			{
+				if (xml_->hasProperty(name) == true)
+					value = xml_->getProperty<T>(name);
+			}
+			else if (reader_->hasProperty(name) == true)
+				value = reader_->getProperty<T>(name);
+		};
+
+		/**
+		 * Declare a field of bool.
+		 *
+		 * @param name Name of the property in XML.
+		 * @param value Reference of the member variable.
+		 * @throw std::out_of_range Binary data is truncated.
+		 */
+		void field(const std::string &name, bool &value)
+		{
+			if (format_ == FORMAT_BINARY)
+			{
+				if (mode_ == SAVE)
+					data_->write((unsigned char)(value ? 1 : 0));
+				else
+				{
+					check_size(1);
+					value = data_->read<unsigned char>() != 0;
+				}
+			}
+			else if (mode_ == SAVE)
+				xml_->setProperty(name, value);
+			else if (format_ == FORMAT_XML)
+			{
+				if (xml_->hasProperty(name) == true)
+					value = xml_->getProperty<bool>(name);
+			}
+			else if (reader_->hasProperty(name) == true)
+				value = reader_->getProperty<bool>(name);
+		};
+
+		/**
+		 * Declare a field of string.
+		 *
+		 * @param name Name of the property in XML.
+		 * @param value Reference of the member variable.
+		 * @throw std::out_of_range Binary data is truncated.
+		 */
+		void field(const std::string &name, std::string &value)
+		{
+			if (format_ == FORMAT_BINARY)
+			{
+				if (mode_ == SAVE)
+				{
+					data_->writeReversely((unsigned int)value.size());
+					data_->write(value);
+				}
+				else
+				{
+					check_size(sizeof(unsigned int));
+					size_t size = data_->readReversely<unsigned int>();
+					check_size(size);
+
+					value.assign((const char*)data_->data() + data_->get_position(), size);
+					data_->set_position(data_->get_position() + size);
+				}
+			}
+			else if (mode_ == SAVE)
+				xml_->setProperty(name, value);
+			else if (format_ == FORMAT_XML)
+			{
+				if (xml_->hasProperty(name) == true)
+					value = xml_->getProperty<std::string>(name);
+			}
+			else if (reader_->hasProperty(name) == true)
+				value = reader_->getProperty<std::string>(name);
+		};
+
+	private:
+		void check_size(size_t size) const
+		{
+			if (data_->get_position() > data_->size() || data_->left_size() < size)
+				throw std::out_of_range("binary data of the entity is truncated.");
+		};
+	};
+};
+};
@@ -71,6 +71,8 @@ namespace protocol
 		virtual void construct(std::shared_ptr<library::XML> xml)
 		{
 			clear();
+			EntityBase::construct(xml); // FIELDS DECLARED BY ARCHIVE()
+
 			if (xml->has(CHILD_TAG()) == false)
 				return;
 
@@ -90,12 +92,80 @@ namespace protocol
 				child_type *entity = createChild(xmlElement);
 				if (entity != nullptr)
 				{
-					entity->construct(xml_list->at(i));
+					EntityBase *base = entity;
+					base->construct(xml_list->at(i));
+
 					emplace_back(entity);
 				}
 			}
 		};
 
+		/**
+		 * @brief Construct data of the Entity from an XML reader
+		 *
+		 * @details
+		 * <p> By default, an XML object of the EntityGroup is built and passed to construct(), thus overridings of 
+		 * construct() in derived classes are kept. Override it and call constructElements() to construct the 
+		 * children one by one as they're read, without building an XML object. </p>
+		 *
+		 * \par [Inherited]
+		 *		@copydoc EntityBase::construct(library::XMLReader&)
+		 */
+		virtual void construct(library::XMLReader &reader) override
+		{
+			EntityBase::construct(reader);
+		};
+
+		/**
+		 * @brief Construct data of the Entity from binary data
+		 *
+		 * @details
+		 * <p> Loads fields declared by archive(), and then the children; number of them and each child's own binary
+		 * data. Children are created by createChild(const ByteArray&). </p>
+		 *
+		 * <p> Number of the children is told by the data, thus it's verified not to exceed the data left. Each child 
+		 * must read a byte at least. </p>
+		 *
+		 * \par [Inherited]
+		 *		@copydoc EntityBase::construct(const ByteArray&)
+		 */
+		virtual void construct(const ByteArray &data) override
+		{
+			clear();
+			EntityBase::construct(data);
+
+			unsigned long long size = 0;
+			EntityArchive archive(EntityArchive::LOAD, (ByteArray&)data);
+			archive.field(CHILD_TAG(), size);
+
+			// THE SIZE IS TOLD BY THE DATA; EACH CHILD TAKES A BYTE AT LEAST
+			if (size > data.left_size())
+				throw std::out_of_range("number of children exceeds the binary data.");
+
+			if (std::is_same<container_type, std::vector<container_type::value_type, container_type::allocator_type>>::value == true)
+			{
+				//FOR RESERVE
+				assign((size_t)size, nullptr);
+				erase(begin(), end());
+			}
+
+			for (unsigned long long i = 0; i < size; i++)
+			{
+				size_t position = data.get_position();
+
+				child_type *entity = createChild(data);
+				if (entity == nullptr)
+					throw std::invalid_argument("unable to create a child from binary data.");
+
+				EntityBase *base = entity;
+				emplace_back(entity);
+				base->construct(data);
+
+				if (data.get_position() == position)
+					throw std::invalid_argument("a child has not read its binary data.");
+			}
+		};
+
 	protected:
 		/**
 		 * @brief Factory method of a child Entity.
@@ -109,6 +179,92 @@ namespace protocol
 		 */
 		virtual auto createChild(std::shared_ptr<library::XML>) -> child_type* = 0;
 
+		/**
+		 * @brief Factory method of a child Entity, from an XML reader.
+		 *
+		 * @details
+		 * <p> Override it not to build an XML object for each child. By default, calls createChild() with an XML
+		 * object having tag and properties of the child only. </p>
+		 *
+		 * @param reader A reader on the start tag of the child.
+		 * @return A new child Entity belongs to EntityGroup.
+		 */
+		virtual auto createChild(library::XMLReader &reader) -> child_type*
+		{
+			return createChild(reader.getElement());
+		};
+
+		/**
+		 * @brief Factory method of a child Entity, from binary data.
+		 *
+		 * @details
+		 * <p> Called before the child's binary data is read. By default, calls createChild() with an empty XML 
+		 * object having tag of the child only. Override it if type of the child is written ahead, in binary data. 
+		 * </p>
+		 *
+		 * @param data Binary data, whose position is on the child.
+		 * @return A new child Entity belongs to EntityGroup.
+		 */
+		virtual auto createChild(const ByteArray &data) -> child_type*
+		{
+			std::shared_ptr<library::XML> xml(new library::XML());
+			xml->setTag(CHILD_TAG());
+
+			return createChild(xml);
+		};
+
+		/**
+		 * @brief Construct the EntityGroup from an XML reader, in a single pass.
+		 *
+		 * @details
+		 * <p> Children are created and constructed one by one, as their tags are read. An XML object for the
+		 * children is never built. Elements which are not children are passed to constructElement(). </p>
+		 *
+		 * <p> Call it from an overridden construct(library::XMLReader&), instead of construct() of the super class.
+		 * Read the EntityGroup's own member variables after calling it; properties of the EntityGroup are kept on 
+		 * its end tag. </p>
+		 *
+		 * @param reader A reader on the start tag of the EntityGroup, to be left on its end tag.
+		 */
+		void constructElements(library::XMLReader &reader)
+		{
+			clear();
+
+			while (reader.read() == library::XMLReader::START_ELEMENT)
+				constructElement(reader);
+
+			// FIELDS DECLARED BY ARCHIVE(), ON THE END TAG
+			EntityArchive archive(reader);
+			this->archive(archive);
+		};
+
+		/**
+		 * @brief Construct an element in the EntityGroup, from an XML reader.
+		 *
+		 * @details
+		 * <p> Called by EntityGroup::constructElements() for each element in the EntityGroup, on its start tag. An 
+		 * element whose tag is CHILD_TAG() is constructed to be a child; others are skipped. Override it to construct
+		 * other members which are expressed by elements, and the reader must be left on the end tag. </p>
+		 *
+		 * @param reader A reader on the start tag of the element.
+		 */
+		virtual void constructElement(library::XMLReader &reader)
+		{
+			if (reader.getTag() == CHILD_TAG())
+			{
+				child_type *entity = createChild(reader);
+				if (entity != nullptr)
+				{
+					EntityBase *base = entity;
+					base->construct(reader);
+
+					emplace_back(entity);
+					return;
+				}
+			}
+			reader.skip();
+		};
+
 	public:
 		/* ------------------------------------------------------------------------------------
 			ACCESSORS
@@ -146,7 +302,7 @@ namespace protocol
 			return std::find_if
 			(
 				begin(), end(),
-				[key](const container_type::value_type &entity) -> bool
+				[&key](const container_type::value_type &entity) -> bool
 				{
 					return entity->key() == key;
 				}
@@ -175,7 +331,7 @@ namespace protocol
 			return std::find_if
 			(
 				begin(), end(),
-				[key](const container_type::value_type &entity) -> bool
+				[&key](const container_type::value_type &entity) -> bool
 				{
 					return entity->key() == key;
 				}
@@ -193,7 +349,7 @@ namespace protocol
 			return std::any_of
 			(
 				begin(), end(),
-				[key](const container_type::value_type &entity) -> bool
+				[&key](const container_type::value_type &entity) -> bool
 				{
 					return entity->key() == key;
 				}
@@ -211,7 +367,7 @@ namespace protocol
 			return std::count_if
 			(
 				begin(), end(),
-				[key](const container_type::value_type &entity) -> bool
+				[&key](const container_type::value_type &entity) -> bool
 				{
 					return entity->key() == key;
 				}
@@ -229,7 +385,7 @@ namespace protocol
 			auto it = std::find_if
 				(
 					begin(), end(),
-					[key](const container_type::value_type &entity) -> bool
+					[&key](const container_type::value_type &entity) -> bool
 					{
 						return entity->key() == key;
 					}
@@ -252,7 +408,7 @@ namespace protocol
 			auto it = std::find_if
 				(
 					begin(), end(),
-					[key](const container_type::value_type &entity) -> bool
+					[&key](const container_type::value_type &entity) -> bool
 					{
 						return entity->key() == key;
 					}
@@ -295,6 +451,27 @@ namespace protocol
 			xml->set(CHILD_TAG(), xmlList);
 			return xml;
 		};
+
+		/**
+		 * @brief Write binary data represents the EntityGroup
+		 *
+		 * @details
+		 * <p> Writes fields declared by archive(), and then number of children and each child's binary data. </p>
+		 *
+		 * \par [Inherited]
+		 *		@copydoc EntityBase::writeByteArray()
+		 */
+		virtual void writeByteArray(ByteArray &data) const override
+		{
+			EntityBase::writeByteArray(data);
+
+			unsigned long long size = this->size();
+			EntityArchive archive(EntityArchive::SAVE, data);
+			archive.field(CHILD_TAG(), size);
+
+			for (auto it = begin(); it != end(); it++)
+				(*it)->writeByteArray(data);
+		};
 	};
 };
 };
\ No newline at end of file
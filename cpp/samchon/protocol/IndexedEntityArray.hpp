@@ -0,0 +1,23 @@
+#pragma once
+#include <samchon/protocol/IndexedEntityGroup.hpp>
+#include <vector>
+
+namespace samchon
+{
+namespace protocol
+{
+	/**
+	 * @brief An IndexedEntityGroup with vector container and children capsuled in shared pointers.
+	 *
+	 * @tparam T A type of children Entity. Must be a class derived from an Entity or Entity itself.
+	 *
+	 * @details
+	 * <p> Same with SharedEntityArray, but lookups by key are done by a hash index. </p>
+	 *
+	 * @see samchon::protocol
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	template <typename T, typename Key = std::string>
+	using IndexedEntityArray = IndexedEntityGroup<std::vector<std::shared_ptr<T>>, T, Key>;
+};
+};
@@ -0,0 +1,350 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/protocol/EntityGroup.hpp>
+
+#include <unordered_map>
+#include <iterator>
+#include <type_traits>
+#include <atomic>
+#include <mutex>
+
+namespace samchon
+{
+namespace protocol
+{
+	/**
+	 * An {@link EntityGroup} indexing its children by their keys.
+	 *
+	 * {@link IndexedEntityGroup} keeps a hash index from {@link Entity.key key} to position of the children, thus
+	 * {@link find find()}, {@link has has()}, {@link count count()}, {@link get get()} and {@link erase erase()} by
+	 * key cost constant time, instead of a linear scan calling {@link Entity.key key()} of each child.
+	 *
+	 * The index is updated by insertions at the end; {@link push_back push_back()} and
+	 * {@link emplace_back emplace_back()}. Other modifications, like {@link insert insert()}, {@link erase erase()}
+	 * and {@link construct construct()}, let the index to be built again on the next lookup.
+	 *
+	 * An index costs hashing keys of all the children once and memory for them. For a group of a few children,
+	 * the linear scan of {@link EntityGroup} is faster; see the *indexed_entity* benchmark for the crossover.
+	 *
+	 * Lookups are *const* and can be done by multiple threads at the same time, like reading a container, even
+	 * if one of them has to build the index; building is guarded by a mutex.
+	 *
+	 * @warning
+	 * Modifications through a reference of the container or the {@link EntityGroup}, and replacing children
+	 * through iterators, are not tracked. Changing key of a child is not tracked, too. Call {@link reindex reindex()}
+	 * after those modifications.
+	 *
+	 * @tparam Container A type of container containing children entity objects, which must be random-access.
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	template <typename Container, typename T, typename Key = std::string>
+	class IndexedEntityGroup
+		: public EntityGroup<Container, T, Key>
+	{
+	private:
+		typedef EntityGroup<Container, T, Key> super;
+
+		static_assert
+		(
+			std::is_same<typename std::iterator_traits<typename Container::iterator>::iterator_category, std::random_access_iterator_tag>::value,
+			"container of an IndexedEntityGroup must be random-access."
+		);
+
+	public:
+		typedef typename super::container_type container_type;
+		typedef typename super::child_type child_type;
+
+	private:
+		/**
+		 * First position of children having a key, and number of them.
+		 */
+		struct IndexEntry
+		{
+			size_t first;
+			size_t count;
+		};
+
+		/**
+		 * A value of {@link indexed_size_} meaning the index is invalidated.
+		 */
+		static const size_t NOT_INDEXED = (size_t)-1;
+
+		mutable std::unordered_map<typename child_type::key_type, IndexEntry> index_;
+
+		/**
+		 * Number of children indexed, published after the {@link index_} is built.
+		 */
+		mutable std::atomic<size_t> indexed_size_;
+		mutable std::mutex index_mtx_;
+
+	public:
+		/* ------------------------------------------------------------------------------------
+			CONSTRUCTORS
+		------------------------------------------------------------------------------------ */
+		/**
+		 * Default Constructor.
+		 */
+		IndexedEntityGroup()
+			: super()
+		{
+			indexed_size_ = NOT_INDEXED;
+		};
+
+		/**
+		 * Copy Constructor.
+		 *
+		 * Children are copied, and the index is built again on the next lookup.
+		 */
+		IndexedEntityGroup(const IndexedEntityGroup &obj)
+			: super(obj)
+		{
+			indexed_size_ = NOT_INDEXED;
+		};
+
+		auto operator=(const IndexedEntityGroup &obj) -> IndexedEntityGroup&
+		{
+			super::operator=(obj);
+			reindex();
+
+			return *this;
+		};
+
+		virtual ~IndexedEntityGroup() = default;
+
+		virtual void construct(std::shared_ptr<library::XML> xml) override
+		{
+			super::construct(xml);
+			reindex();
+		};
+
+		virtual void construct(library::XMLReader &reader) override
+		{
+			super::construct(reader);
+			reindex();
+		};
+
+		virtual void construct(const ByteArray &data) override
+		{
+			super::construct(data);
+			reindex();
+		};
+
+		/**
+		 * Invalidate the index.
+		 *
+		 * The index is built again on the next lookup. Call it after modifications which are not tracked.
+		 */
+		void reindex()
+		{
+			indexed_size_ = NOT_INDEXED;
+			index_.clear();
+		};
+
+		/* ------------------------------------------------------------------------------------
+			ACCESSORS
+		------------------------------------------------------------------------------------ */
+		/**
+		 * Get iterator to the first element having the *key*.
+		 *
+		 * @param key Key to be searched for
+		 * @return An iterator to the element, or {@link end end()} if there's none.
+		 */
+		auto find(const typename child_type::key_type &key) -> typename container_type::iterator
+		{
+			const IndexEntry *entry = lookup(key);
+			if (entry == nullptr)
+				return this->end();
+			else
+				return this->begin() + entry->first;
+		};
+
+		/**
+		 * Get const iterator to the first element having the *key*.
+		 *
+		 * @param key Key to be searched for
+		 * @return An iterator to the element, or {@link end end()} if there's none.
+		 */
+		auto find(const typename child_type::key_type &key) const -> typename container_type::const_iterator
+		{
+			const IndexEntry *entry = lookup(key);
+			if (entry == nullptr)
+				return this->end();
+			else
+				return this->begin() + entry->first;
+		};
+
+		/**
+		 * Test whether an element having the *key* exists.
+		 */
+		auto has(const typename child_type::key_type &key) const -> bool
+		{
+			return lookup(key) != nullptr;
+		};
+
+		/**
+		 * Count elements having the *key*.
+		 */
+		auto count(const typename child_type::key_type &key) const -> size_t
+		{
+			const IndexEntry *entry = lookup(key);
+			return (entry == nullptr) ? 0 : entry->count;
+		};
+
+		/**
+		 * Access the first element having the *key*.
+		 *
+		 * @throw std::out_of_range There's no element having the *key*.
+		 */
+		auto get(const typename child_type::key_type &key) -> typename container_type::value_type&
+		{
+			const IndexEntry *entry = lookup(key);
+			if (entry == nullptr)
+				throw std::out_of_range("out of range");
+
+			return container_type::operator[](entry->first);
+		};
+
+		/**
+		 * Access the first const element having the *key*.
+		 *
+		 * @throw std::out_of_range There's no element having the *key*.
+		 */
+		auto get(const typename child_type::key_type &key) const -> const typename container_type::value_type&
+		{
+			const IndexEntry *entry = lookup(key);
+			if (entry == nullptr)
+				throw std::out_of_range("out of range");
+
+			return container_type::operator[](entry->first);
+		};
+
+		/* ------------------------------------------------------------------------------------
+			ELEMENTS I/O
+		------------------------------------------------------------------------------------ */
+		void push_back(const typename container_type::value_type &val)
+		{
+			container_type::push_back(val);
+			index_back();
+		};
+		void push_back(typename container_type::value_type &&val)
+		{
+			container_type::push_back(std::move(val));
+			index_back();
+		};
+
+		template <typename... Args>
+		void emplace_back(Args&&... args)
+		{
+			container_type::emplace_back(std::forward<Args>(args)...);
+			index_back();
+		};
+
+		template <typename... Args>
+		auto insert(Args&&... args) -> decltype(std::declval<container_type&>().insert(std::forward<Args>(args)...))
+		{
+			reindex();
+			return container_type::insert(std::forward<Args>(args)...);
+		};
+
+		template <typename... Args>
+		void assign(Args&&... args)
+		{
+			reindex();
+			container_type::assign(std::forward<Args>(args)...);
+		};
+
+		auto erase(typename container_type::const_iterator it) -> typename container_type::iterator
+		{
+			reindex();
+			return container_type::erase(it);
+		};
+		auto erase(typename container_type::const_iterator first, typename container_type::const_iterator last) -> typename container_type::iterator
+		{
+			reindex();
+			return container_type::erase(first, last);
+		};
+
+		/**
+		 * Erase elements having the *key*.
+		 */
+		void erase(const typename child_type::key_type &key)
+		{
+			if (has(key) == false)
+				return;
+
+			super::erase(key);
+			reindex();
+		};
+
+		void pop_back()
+		{
+			reindex();
+			container_type::pop_back();
+		};
+
+		void clear()
+		{
+			container_type::clear();
+
+			index_.clear();
+			indexed_size_ = 0;
+		};
+
+	private:
+		/* ------------------------------------------------------------------------------------
+			INDEX
+		------------------------------------------------------------------------------------ */
+		auto lookup(const typename child_type::key_type &key) const -> const IndexEntry*
+		{
+			// BUILD THE INDEX, IF INVALIDATED OR THE CONTAINER HAS BEEN MODIFIED DIRECTLY
+			if (indexed_size_.load(std::memory_order_acquire) != this->size())
+			{
+				// ONLY A READER BUILDS, OTHERS WAIT FOR IT
+				std::unique_lock<std::mutex> uk(index_mtx_);
+				if (indexed_size_.load(std::memory_order_relaxed) != this->size())
+					build_index();
+			}
+
+			auto it = index_.find(key);
+			if (it == index_.end())
+				return nullptr;
+			else
+				return &it->second;
+		};
+
+		void build_index() const
+		{
+			index_.clear();
+			index_.reserve(this->size());
+
+			for (size_t i = 0; i < this->size(); i++)
+				insert_index(container_type::operator[](i)->key(), i);
+
+			indexed_size_.store(this->size(), std::memory_order_release);
+		};
+
+		void index_back()
+		{
+			// NOT BUILT YET, OR OUT OF DATE
+			if (indexed_size_ == NOT_INDEXED || indexed_size_ + 1 != this->size())
+			{
+				reindex();
+				return;
+			}
+
+			insert_index(this->back()->key(), this->size() - 1);
+			indexed_size_ = this->size();
+		};
+
+		void insert_index(const typename child_type::key_type &key, size_t position) const
+		{
+			auto it = index_.find(key);
+			if (it == index_.end())
+				index_.emplace(key, IndexEntry{ position, 1 });
+			else
+				it->second.count++;
+		};
+	};
+};
+};
@@ -2,10 +2,15 @@
 #include <samchon/protocol/SharedEntityArray.hpp>
 #	include <samchon/protocol/InvokeParameter.hpp>
 
+#include <algorithm>
+#include <atomic>
+
 namespace samchon
 {
 namespace protocol
 {
+	class InvokeFrame;
+
 	/**
 	 * @brief Standard message of network I/O
 	 *
@@ -44,6 +49,12 @@ namespace protocol
 		 */
 		std::string listener;
 
+	private:
+		/**
+		 * @brief Encodings shared by peers of a broadcast
+		 */
+		std::shared_ptr<InvokeFrame> frame_;
+
 	public:
 		/* --------------------------------------------------------------------
 			CONSTRUCTORS
@@ -71,6 +82,62 @@ namespace protocol
 			super::construct(xml);
 		};
 
+		/**
+		 * @brief Construct from an XML document
+		 *
+		 * @details
+		 * <p> Constructs the Invoke message from an {@link library::XMLDocument}, whose nodes refer to the received
+		 * string without copy. Parameters of XML type keep the <i>document</i>, thus the document is released at
+		 * once with the Invoke message; otherwise, right after the construction. </p>
+		 *
+		 * @param document A document represents the Invoke message.
+		 */
+		void construct(std::shared_ptr<library::XMLDocument> document)
+		{
+			clear();
+
+			const library::XMLNode *root = document->getRoot();
+			if (root == nullptr)
+				return;
+
+			listener = root->getProperty<std::string>("listener");
+
+			for (const library::XMLNode *node = root->findChild("parameter"); node != nullptr; node = node->findNextSibling("parameter"))
+			{
+				std::shared_ptr<InvokeParameter> parameter(new InvokeParameter());
+				parameter->construct(document, node);
+
+				push_back(parameter);
+			}
+		};
+
+		/**
+		 * @brief Construct from binary data
+		 *
+		 * @details
+		 * <p> Constructs the Invoke message from binary data written by {@link toByteArray toByteArray()}. The 
+		 * data is read from current {@link ByteArray::get_position position} of the <i>data</i>. </p>
+		 *
+		 * @param data Binary data represents the Invoke message.
+		 * @throw std::out_of_range The data is truncated.
+		 */
+		void construct(const ByteArray &data)
+		{
+			clear();
+			listener = InvokeParameter::read_binary_string(data);
+
+			size_t size = InvokeParameter::read_binary<unsigned int>(data);
+			reserve(std::min(size, data.left_size()));
+
+			for (size_t i = 0; i < size; i++)
+			{
+				std::shared_ptr<InvokeParameter> parameter(new InvokeParameter());
+				parameter->construct(data);
+
+				push_back(parameter);
+			}
+		};
+
 	protected:
 		virtual auto createChild(std::shared_ptr<library::XML>) -> InvokeParameter* override
 		{
@@ -152,6 +219,19 @@ namespace protocol
 			listener = val;
 		};
 
+		/**
+		 * @brief Get the attached {@link InvokeFrame}, if being broadcasted
+		 */
+		auto _Get_frame() const -> std::shared_ptr<InvokeFrame>
+		{
+			return std::atomic_load(&frame_);
+		};
+
+		void _Set_frame(std::shared_ptr<InvokeFrame> frame)
+		{
+			std::atomic_store(&frame_, frame);
+		};
+
 		/* -----------------------------------------------------------------------
 			EXPORTERS
 		----------------------------------------------------------------------- */
@@ -171,6 +251,34 @@ namespace protocol
 
 			return xml;
 		};
+
+		/**
+		 * @brief Get binary data represents the Invoke message
+		 *
+		 * @details
+		 * <p> Returns binary data, a compact alternative of {@link toXML toXML()}, which can be restored by 
+		 * {@link construct construct(const ByteArray&)}. Parsing and stringifying XML are skipped and 
+		 * ByteArray parameters are contained in the binary data directly. </p>
+		 *
+		 * <pre>
+		 * [listener size: 4][listener]
+		 * [number of parameters: 4]
+		 * { [type code: 1][name size: 4][name][value] } * N
+		 * </pre>
+		 *
+		 * @return Binary data represents the Invoke message.
+		 */
+		auto toByteArray() const -> ByteArray
+		{
+			ByteArray data;
+			InvokeParameter::write_binary_string(data, listener);
+			data.writeReversely((unsigned int)size());
+
+			for (size_t i = 0; i < size(); i++)
+				at(i)->write_binary(data);
+
+			return data;
+		};
 	};
 };
 };
\ No newline at end of file
@@ -0,0 +1,196 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <string>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <type_traits>
+#include <samchon/protocol/Invoke.hpp>
+
+namespace samchon
+{
+namespace protocol
+{
+	/**
+	 * Decoder of an {@link InvokeParameter} into a type of argument.
+	 *
+	 * Numbers are converted from their binary values, without passing through *double* for integers. 
+	 * {@link ByteArray ByteArrays} are referenced, not copied.
+	 *
+	 * @tparam T Type of the argument, without reference and const.
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	template <typename T>
+	struct InvokeArgument
+	{
+		static auto decode(const InvokeParameter &parameter) -> T
+		{
+			return parameter.getValue<T>();
+		};
+	};
+
+	template <>
+	struct InvokeArgument<std::string>
+	{
+		static auto decode(const InvokeParameter &parameter) -> std::string
+		{
+			// A NUMBER IS FORMATTED
+			return parameter.getValue<std::string>();
+		};
+	};
+
+	template <>
+	struct InvokeArgument<ByteArray>
+	{
+		static auto decode(const InvokeParameter &parameter) -> const ByteArray&
+		{
+			return parameter.referValue<ByteArray>();
+		};
+	};
+
+	template <>
+	struct InvokeArgument<std::shared_ptr<library::XML>>
+	{
+		static auto decode(const InvokeParameter &parameter) -> std::shared_ptr<library::XML>
+		{
+			return parameter.getValueAsXML();
+		};
+	};
+
+	/**
+	 * A registry of listeners of {@link Invoke} messages.
+	 *
+	 * The {@link InvokeDispatcher} binds names of listeners to member functions of the *Owner*, once for a class,
+	 * and calls the function matched with {@link Invoke.getListener listener} of a message in O(1), by a hash table
+	 * built in the binding time. Parameters of the message are decoded straight into types of the function's
+	 * arguments, by {@link InvokeArgument}, in order.
+	 *
+	 * Listeners not bound are left for the ordinary {@link IProtocol.replyData replyData()}.
+	 *
+	 * @code{.cpp}
+	 * virtual void replyData(std::shared_ptr<protocol::Invoke> invoke) override
+	 * {
+	 *	static protocol::InvokeDispatcher<Calculator> dispatcher
+	 *	({
+	 *		{ "plus", &Calculator::plus }, // void plus(double, double)
+	 *		{ "print", &Calculator::print } // void print(const std::string&)
+	 *	});
+	 *
+	 *	if (dispatcher.dispatch(this, invoke) == false)
+	 *		super::replyData(invoke);
+	 * };
+	 * @endcode
+	 *
+	 * @tparam Owner Type of the class owning the listeners.
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	template <class Owner>
+	class InvokeDispatcher
+	{
+	private:
+		typedef std::function<void(Owner*, const Invoke&)> Listener;
+
+		std::unordered_map<std::string, Listener> listeners;
+
+	public:
+		/**
+		 * A pair of a listener's name and a member function, for the list constructor.
+		 */
+		struct Binding
+		{
+			std::string name;
+			Listener listener;
+
+			template <typename Ret, typename... Args>
+			Binding(const std::string &name, Ret(Owner::*method)(Args...))
+				: name(name), listener(wrap(method)) {};
+		};
+
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Default Constructor.
+		 */
+		InvokeDispatcher()
+		{
+		};
+
+		/**
+		 * Construct from bindings.
+		 *
+		 * @param bindings Pairs of listener names and member functions.
+		 */
+		InvokeDispatcher(std::initializer_list<Binding> bindings)
+		{
+			listeners.reserve(bindings.size());
+
+			for (auto it = bindings.begin(); it != bindings.end(); it++)
+				listeners[it->name] = it->listener;
+		};
+
+		/**
+		 * Bind a listener.
+		 *
+		 * @param name Name of the listener.
+		 * @param method A member function to call. Its arguments are decoded from parameters of the message.
+		 */
+		template <typename Ret, typename... Args>
+		void bind(const std::string &name, Ret(Owner::*method)(Args...))
+		{
+			listeners[name] = wrap(method);
+		};
+
+		/**
+		 * Test whether a listener is bound.
+		 */
+		auto has(const std::string &name) const -> bool
+		{
+			return listeners.find(name) != listeners.end();
+		};
+
+		/* ---------------------------------------------------------
+			DISPATCH
+		--------------------------------------------------------- */
+		/**
+		 * Dispatch an {@link Invoke} message.
+		 *
+		 * @param owner Object to call the listener of.
+		 * @param invoke An {@link Invoke} message to dispatch.
+		 *
+		 * @return Whether the listener is bound. If false, nothing has been called.
+		 * @throw std::out_of_range The message has fewer parameters than the listener's arguments.
+		 */
+		auto dispatch(Owner *owner, std::shared_ptr<Invoke> invoke) const -> bool
+		{
+			auto it = listeners.find(invoke->getListener());
+			if (it == listeners.end())
+				return false;
+
+			it->second(owner, *invoke);
+			return true;
+		};
+
+	private:
+		template <typename Ret, typename... Args>
+		static auto wrap(Ret(Owner::*method)(Args...)) -> Listener
+		{
+			return [method](Owner *owner, const Invoke &invoke)
+			{
+				if (invoke.size() < sizeof...(Args))
+					throw std::out_of_range("parameters of " + invoke.getListener() + " are not enough.");
+
+				call(owner, method, invoke, std::index_sequence_for<Args...>());
+			};
+		};
+
+		template <typename Ret, typename... Args, size_t... Index>
+		static void call(Owner *owner, Ret(Owner::*method)(Args...), const Invoke &invoke, std::index_sequence<Index...>)
+		{
+			(owner->*method)(InvokeArgument<typename std::decay<Args>::type>::decode(*invoke.at(Index))...);
+		};
+	};
+};
+};
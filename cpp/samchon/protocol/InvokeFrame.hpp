@@ -0,0 +1,129 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <samchon/protocol/Invoke.hpp>
+
+namespace samchon
+{
+namespace protocol
+{
+	/**
+	 * Encodings of an {@link Invoke} message, shared by peers of a broadcast.
+	 *
+	 * When an {@link Invoke} message is sent to many peers, like {@link templates::service::Server.sendData}, each
+	 * peer's {@link Communicator} encodes the same message again; an XML object and its string, for each peer. While
+	 * an {@link InvokeFrame} is attached to the message, by a {@link Scope}, the {@link Communicator communicators}
+	 * {@link fetch} encodings from the frame instead. Each encoding is done once, by the first peer who needs it, and
+	 * the others write from the same, reference-counted buffers:
+	 *
+	 *	- {@link TEXT}: XML string of the message.
+	 *	- {@link BINARY}: {@link Invoke.toByteArray binary data} of the message.
+	 *	- {@link FRAME}, {@link BINARY_FRAME}: frames of the Samchon Framework's own protocol.
+	 *	- {@link WEB_SOCKET_FRAME}: unmasked frames of web-socket, written by servers.
+	 *
+	 * Frames depending on state of a connection, like compressed ones, are encoded by each peer from the shared
+	 * {@link TEXT} or {@link BINARY}.
+	 *
+	 * ```cpp
+	 * virtual void sendData(std::shared_ptr<protocol::Invoke> invoke) override
+	 * {
+	 *	protocol::InvokeFrame::Scope scope(invoke);
+	 *
+	 *	for (size_t i = 0; i < size(); i++)
+	 *		at(i)->sendData(invoke);
+	 * };
+	 * ```
+	 *
+	 * @warning The {@link Invoke} message must not be modified while a frame is attached.
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class InvokeFrame
+	{
+	public:
+		/**
+		 * Kinds of encodings.
+		 */
+		enum Encoding : size_t
+		{
+			TEXT = 0,
+			BINARY = 1,
+			FRAME = 2,
+			BINARY_FRAME = 3,
+			WEB_SOCKET_FRAME = 4
+		};
+
+		/**
+		 * Attaches an {@link InvokeFrame} to an {@link Invoke} message, while the scope lives.
+		 *
+		 * If a frame is attached already, by a broadcast of a higher level, the frame is shared and kept.
+		 */
+		class Scope
+		{
+		private:
+			std::shared_ptr<Invoke> invoke_;
+			bool attached_;
+
+		public:
+			/**
+			 * Construct from an {@link Invoke} message to broadcast.
+			 *
+			 * @param invoke An {@link Invoke} message to broadcast.
+			 */
+			Scope(std::shared_ptr<Invoke> invoke)
+				: invoke_(invoke)
+			{
+				attached_ = (invoke->_Get_frame() == nullptr);
+
+				if (attached_ == true)
+					invoke->_Set_frame(std::make_shared<InvokeFrame>());
+			};
+
+			Scope(const Scope &) = delete;
+			auto operator=(const Scope &) -> Scope& = delete;
+
+			~Scope()
+			{
+				if (attached_ == true)
+					invoke_->_Set_frame(nullptr);
+			};
+		};
+
+	private:
+		static const size_t ENCODING_SIZE = 5;
+
+		std::array<std::once_flag, ENCODING_SIZE> flags_;
+		std::array<std::shared_ptr<const void>, ENCODING_SIZE> encodings_;
+
+	public:
+		/**
+		 * Default Constructor.
+		 */
+		InvokeFrame() = default;
+
+		/**
+		 * Fetch an encoding.
+		 *
+		 * The *encoder* is called only by the first fetch of the *encoding*; the others wait for it and share its
+		 * result. If the *encoder* throws, the next fetch tries again.
+		 *
+		 * @tparam T Type of the encoding.
+		 * @param encoding Kind of the encoding.
+		 * @param encoder A function returning ```std::shared_ptr<T>``` of the encoding.
+		 *
+		 * @return The shared encoding.
+		 */
+		template <typename T, typename Encoder>
+		auto fetch(Encoding encoding, Encoder encoder) -> std::shared_ptr<const T>
+		{
+			std::call_once(flags_[encoding], [this, encoding, &encoder]()
+			{
+				encodings_[encoding] = std::shared_ptr<const T>(encoder());
+			});
+			return std::static_pointer_cast<const T>(encodings_[encoding]);
+		};
+	};
+};
+};
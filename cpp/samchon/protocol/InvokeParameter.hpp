@@ -1,9 +1,20 @@
 #pragma once
 #include <samchon/protocol/Entity.hpp>
 
+#include <atomic>
 #include <sstream>
+#include <stdexcept>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <climits>
+#include <new>
+#include <type_traits>
 #include <samchon/ByteArray.hpp>
 #include <samchon/WeakString.hpp>
+#include <samchon/library/ByteArrayPool.hpp>
+#include <samchon/library/XMLDocument.hpp>
+#include <samchon/library/XMLReader.hpp>
 
 namespace samchon
 {
@@ -27,6 +38,10 @@ namespace protocol
 	 * values of the custom type must be enable to expressed by one of those types; number, string, XML
 	 * and ByteArray. </p>
 	 *
+	 * <p> The value is held in a tagged union; only the member of its {@link Type} is alive. A number is kept in
+	 * its binary form, a 64 bits integer or a double, and converted to a string only when the parameter is
+	 * serialized or referenced as a string. </p>
+	 *
 	 * ![Basic Components](http://samchon.github.io/framework/images/design/cpp_class_diagram/protocol_invoke.png)
 	 *
 	 * @note
@@ -49,40 +64,99 @@ namespace protocol
 	{
 		friend class Invoke;
 
+	public:
+		/**
+		 * @brief Type codes of the value
+		 *
+		 * @details
+		 * <p> INTEGER, UNSIGNED_INTEGER and REAL are all "number" in {@link getType getType()}. </p>
+		 */
+		enum Type : unsigned char
+		{
+			INTEGER = 0,
+			UNSIGNED_INTEGER = 1,
+			REAL = 2,
+			STRING = 3,
+			XML = 4,
+			BYTE_ARRAY = 5,
+			CUSTOM = 6
+		};
+
 	protected:
 		typedef Entity<std::string> super;
 
+		/**
+		 * @brief A value of a custom type, expressed by a string
+		 */
+		struct CustomValue
+		{
+			std::string type;
+			std::string str;
+		};
+
 		/**
 		 * @brief A name can represent the parameter
 		 */
 		std::string name;
 
 		/**
-		 * @brief Type of the parameter
-		 *
-		 * @details
-		 * <p> List of pre-defined types </p>
-		 *	\li number
-		 *	\li string
-		 *	\li XML
-		 *	\li ByteArray
+		 * @brief Type of the parameter, tag of the union
 		 */
-		std::string type;
+		Type type = STRING;
+
+		union
+		{
+			/**
+			 * @brief A number if the type is INTEGER or UNSIGNED_INTEGER
+			 */
+			long long integer;
 
+			/**
+			 * @brief A number if the type is REAL
+			 */
+			double real;
+
+			/**
+			 * @brief A string value if the type is STRING
+			 */
+			std::string str;
+
+			/**
+			 * @brief An XML object if the type is XML
+			 */
+			std::shared_ptr<library::XML> xml;
+
+			/**
+			 * @brief A binary value if the type is BYTE_ARRAY
+			 */
+			ByteArray byte_array;
+
+			/**
+			 * @brief Type name and a string value if the type is CUSTOM
+			 */
+			CustomValue custom;
+		};
+
+	private:
 		/**
-		 * @brief A string value if the type is "string" or "number"
+		 * @brief Whether the byte_array is borrowed from the ByteArrayPool
 		 */
-		std::string str;
+		bool byte_array_borrowed = false;
 
 		/**
-		 * @brief An XML object if the type is "XML"
+		 * @brief A node of the XML value and its document, if constructed from an XMLDocument
+		 *
+		 * @details
+		 * <p> The XML object is built from the node only when it's requested. The document is held by the node's 
+		 * parameters, thus it's released with the Invoke message. </p>
 		 */
-		std::shared_ptr<library::XML> xml;
+		const library::XMLNode *xml_node = nullptr;
+		std::shared_ptr<library::XMLDocument> xml_document;
 
 		/**
-		 * @brief A binary value if the type is "ByteArray"
+		 * @brief A number formatted to a string by referValue(), cached until the value is changed
 		 */
-		ByteArray byte_array;
+		mutable std::atomic<std::string*> number_str{ nullptr };
 
 	public:
 		/* ----------------------------------------------------------
@@ -93,6 +167,17 @@ namespace protocol
 		 */
 		InvokeParameter()
 		{
+			new (&str) std::string();
+		};
+
+		/**
+		 * @brief Copy Constructor
+		 */
+		InvokeParameter(const InvokeParameter &obj)
+		{
+			new (&str) std::string();
+
+			*this = obj;
 		};
 
 		/**
@@ -106,14 +191,15 @@ namespace protocol
 		 * <i>Invoke::InvokeParameter(string, XML)</i>. </p>
 		 *
 		 * @param name A name can represent the InvokeParameter
-		 * @param type Type of value in the InvokeParameter
+		 * @param type_name Type of value in the InvokeParameter
 		 * @param value A value capsuled by a string
 		 */
-		InvokeParameter(const std::string &name, const std::string &type, const std::string &val)
+		InvokeParameter(const std::string &name, const std::string &type_name, const std::string &val)
 		{
+			new (&str) std::string();
+
 			this->name = name;
-			this->type = type;
-			this->str = val;
+			construct_by_type(type_name, val);
 		};
 
 		/**
@@ -152,6 +238,7 @@ namespace protocol
 		template <typename T>
 		InvokeParameter(const std::string &name, const T &val)
 		{
+			new (&str) std::string();
 			this->name = name;
 
 			construct_by_varadic_template(val);
@@ -159,10 +246,8 @@ namespace protocol
 
 		InvokeParameter(const std::string &name, const char *ptr)
 		{
+			new (&str) std::string(ptr);
 			this->name = name;
-			this->type = "string";
-
-			this->str = ptr;
 		};
 
 		//MOVE CONSTRUCTORS
@@ -171,10 +256,8 @@ namespace protocol
 		 */
 		InvokeParameter(const std::string &name, std::string &&str)
 		{
+			new (&this->str) std::string(move(str));
 			this->name = name;
-			this->type = "string";
-
-			this->str = move(str);
 		};
 
 		/**
@@ -182,13 +265,56 @@ namespace protocol
 		 */
 		InvokeParameter(const std::string &name, ByteArray &&byte_array)
 		{
+			new (&this->byte_array) ByteArray(move(byte_array));
 			this->name = name;
-			this->type = "ByteArray";
+			this->type = BYTE_ARRAY;
+		};
 
-			this->byte_array = move(byte_array);
+		virtual ~InvokeParameter()
+		{
+			destruct_value();
+			reset_number_str();
 		};
 
-		virtual ~InvokeParameter() = default;
+		/**
+		 * @brief Copy Assignment
+		 *
+		 * @details
+		 * <p> A borrowed buffer of the <i>obj</i> is copied into a buffer not borrowed. </p>
+		 */
+		auto operator=(const InvokeParameter &obj) -> InvokeParameter&
+		{
+			if (this == &obj)
+				return *this;
+
+			name = obj.name;
+			set_type(obj.type);
+
+			switch (type)
+			{
+			case INTEGER:
+			case UNSIGNED_INTEGER:
+				integer = obj.integer;
+				break;
+			case REAL:
+				real = obj.real;
+				break;
+			case STRING:
+				str = obj.str;
+				break;
+			case XML:
+				xml = obj.xml;
+				xml_node = obj.xml_node;
+				xml_document = obj.xml_document;
+				break;
+			case BYTE_ARRAY:
+				byte_array = obj.byte_array;
+				break;
+			default:
+				custom = obj.custom;
+			}
+			return *this;
+		};
 
 		virtual void construct(std::shared_ptr<library::XML> xml) override
 		{
@@ -197,65 +323,489 @@ namespace protocol
 			else
 				this->name = "";
 
-			this->type = xml->getProperty("type");
+			const std::string &type_name = xml->getProperty("type");
 
-			if (type == "XML")
+			if (type_name == "XML")
 			{
+				set_type(XML);
+				reset_xml_node();
+
 				if (xml->empty())
 					this->xml = nullptr;
 				else
 					this->xml = xml->begin()->second->at(0);
 			}
-			else if (type == "ByteArray")
+			else if (type_name == "ByteArray")
 			{
-				size_t size = xml->getValue<size_t>();
+				// THE BUFFER IS BORROWED WHEN THE BINARY DATA ARRIVES
+				set_type(BYTE_ARRAY);
+			}
+			else
+				construct_by_type(type_name, xml->getValue());
+		};
 
-				byte_array.reserve(size);
+		/**
+		 * @brief Construct from a node of an XMLDocument
+		 *
+		 * @details
+		 * <p> Numbers and strings are read from the node directly. A value of XML type is not built, but the node
+		 * is kept with its <i>document</i>, to be converted by {@link getValueAsXML getValueAsXML()} only when it's
+		 * requested. </p>
+		 *
+		 * @param document The document the <i>node</i> belongs to.
+		 * @param node A node represents the parameter.
+		 */
+		void construct(std::shared_ptr<library::XMLDocument> document, const library::XMLNode *node)
+		{
+			if (node->hasProperty("name") == true)
+				this->name = node->getProperty<std::string>("name");
+			else
+				this->name = "";
+
+			WeakString type_name = node->getProperty<WeakString>("type");
+
+			if (type_name == "XML")
+			{
+				set_type(XML);
+				this->xml = nullptr;
+
+				xml_node = node->getFirstChild();
+				xml_document = (xml_node == nullptr) ? nullptr : document;
+			}
+			else if (type_name == "ByteArray")
+			{
+				// THE BUFFER IS BORROWED WHEN THE BINARY DATA ARRIVES
+				set_type(BYTE_ARRAY);
 			}
 			else
-				this->str = xml->getValue();
+				construct_by_type(type_name.str(), node->getValue<std::string>());
+		};
+
+		/**
+		 * @brief Construct from binary data
+		 *
+		 * @details
+		 * <p> Constructs the InvokeParameter from binary data written by {@link toByteArray toByteArray()}. The
+		 * data is read from current {@link ByteArray::get_position position} of the <i>data</i> and the position
+		 * is moved to the end of the parameter. </p>
+		 *
+		 * <p> Unlike construction by XML, a ByteArray value is contained in the binary data directly. </p>
+		 *
+		 * @param data Binary data represents the parameter.
+		 * @throw std::out_of_range The data is truncated.
+		 */
+		void construct(const ByteArray &data)
+		{
+			unsigned char binary_type = read_binary<unsigned char>(data);
+			name = read_binary_string(data);
+
+			if (binary_type == BINARY_INT64 || binary_type == BINARY_UINT64)
+			{
+				set_type((binary_type == BINARY_INT64) ? INTEGER : UNSIGNED_INTEGER);
+				integer = read_binary<long long>(data);
+			}
+			else if (binary_type == BINARY_DOUBLE)
+			{
+				set_type(REAL);
+				real = read_binary<double>(data);
+			}
+			else if (binary_type == BINARY_NUMBER)
+				construct_number(read_binary_string(data));
+			else if (binary_type == BINARY_STRING)
+			{
+				set_type(STRING);
+				str = read_binary_string(data);
+			}
+			else if (binary_type == BINARY_XML)
+			{
+				set_type(XML);
+				reset_xml_node();
+
+				const std::string &xml_str = read_binary_string(data);
+				if (xml_str.empty() == true)
+					this->xml = nullptr;
+				else
+					this->xml.reset(new library::XML(xml_str));
+			}
+			else if (binary_type == BINARY_BYTE_ARRAY)
+			{
+				size_t size = (size_t)read_binary<unsigned long long>(data);
+				check_binary_size(data, size);
+
+				const unsigned char *first = data.data() + data.get_position();
+				memcpy(borrowByteArray(size).data(), first, size);
+				((ByteArray&)data).set_position(data.get_position() + size);
+			}
+			else
+			{
+				set_type(CUSTOM);
+
+				custom.type = read_binary_string(data);
+				custom.str = read_binary_string(data);
+			}
 		};
 
 		auto byteArrayCapacity() const -> size_t
 		{
-			return byte_array.capacity();
+			return (type == BYTE_ARRAY) ? byte_array.capacity() : 0;
 		};
 
 		void setByteArray(ByteArray &&ba)
 		{
+			set_type(BYTE_ARRAY);
 			byte_array = move(ba);
 		};
 
+		/**
+		 * @brief Borrow a buffer for the ByteArray value
+		 *
+		 * @details
+		 * <p> Replaces the ByteArray value with a buffer borrowed from the {@link library::ByteArrayPool}, to receive
+		 * binary data. The buffer is not zero-filled, thus it must be overwritten. The buffer is given back to the pool
+		 * when this parameter is destroyed. </p>
+		 *
+		 * @param size Size of the binary data to receive.
+		 * @return The ByteArray value.
+		 */
+		auto borrowByteArray(size_t size) -> ByteArray&
+		{
+			set_type(BYTE_ARRAY);
+			library::ByteArrayPool &pool = library::ByteArrayPool::getInstance();
+
+			if (byte_array_borrowed == true)
+				pool.recycle(move(byte_array));
+
+			byte_array = pool.borrow(size);
+			byte_array_borrowed = true;
+
+			return byte_array;
+		};
+
+	private:
+		/* ----------------------------------------------------------
+			UNION HELPERS
+		---------------------------------------------------------- */
+		/**
+		 * @brief Change type, destructing the previous value and constructing an empty value
+		 */
+		void set_type(Type val)
+		{
+			// THE VALUE IS TO BE CHANGED
+			reset_number_str();
+
+			if (type == val)
+				return;
+
+			destruct_value();
+			type = val;
+
+			switch (type)
+			{
+			case INTEGER:
+			case UNSIGNED_INTEGER:
+				integer = 0;
+				break;
+			case REAL:
+				real = 0.0;
+				break;
+			case STRING:
+				new (&str) std::string();
+				break;
+			case XML:
+				new (&xml) std::shared_ptr<library::XML>();
+				break;
+			case BYTE_ARRAY:
+				new (&byte_array) ByteArray();
+				break;
+			default:
+				new (&custom) CustomValue();
+			}
+		};
+
+		void destruct_value()
+		{
+			typedef std::string string_type;
+			typedef std::shared_ptr<library::XML> xml_type;
+
+			switch (type)
+			{
+			case STRING:
+				str.~string_type();
+				break;
+			case XML:
+				xml.~xml_type();
+				reset_xml_node();
+				break;
+			case BYTE_ARRAY:
+				// GIVE BACK THE BUFFER TO BE REUSED
+				if (byte_array_borrowed == true)
+				{
+					library::ByteArrayPool::getInstance().recycle(move(byte_array));
+					byte_array_borrowed = false;
+				}
+				byte_array.~ByteArray();
+				break;
+			case CUSTOM:
+				custom.~CustomValue();
+				break;
+			default:
+				break;
+			}
+		};
+
+		void reset_xml_node()
+		{
+			xml_node = nullptr;
+			xml_document.reset();
+		};
+
+		void reset_number_str()
+		{
+			delete number_str.exchange(nullptr);
+		};
+
+		/**
+		 * @brief Construct value from a type name and a string
+		 */
+		void construct_by_type(const std::string &type_name, const std::string &val)
+		{
+			if (type_name == "number")
+				construct_number(val);
+			else if (type_name == "string")
+			{
+				set_type(STRING);
+				str = val;
+			}
+			else if (type_name == "XML")
+			{
+				set_type(XML);
+				xml = val.empty() ? nullptr : std::make_shared<library::XML>(val);
+			}
+			else if (type_name == "ByteArray")
+				set_type(BYTE_ARRAY);
+			else
+			{
+				set_type(CUSTOM);
+
+				custom.type = type_name;
+				custom.str = val;
+			}
+		};
+
+		/**
+		 * @brief Parse a number from a string, to an integer if possible
+		 */
+		void construct_number(const std::string &val)
+		{
+			const char *first = val.c_str();
+			char *last;
+
+			if (val.find_first_of(".eEnN") == std::string::npos)
+			{
+				if (val.find('-') == std::string::npos)
+				{
+					unsigned long long number = std::strtoull(first, &last, 10);
+
+					set_type((number > (unsigned long long)LLONG_MAX) ? UNSIGNED_INTEGER : INTEGER);
+					integer = (long long)number;
+				}
+				else
+				{
+					set_type(INTEGER);
+					integer = std::strtoll(first, &last, 10);
+				}
+
+				if (*last == '\0')
+					return;
+			}
+
+			set_type(REAL);
+			real = std::strtod(first, &last);
+		};
+
+		/**
+		 * @brief Format a number to a string, to be parsed back into the same number
+		 */
+		auto format_number() const -> std::string
+		{
+			if (type == INTEGER)
+				return std::to_string(integer);
+			else if (type == UNSIGNED_INTEGER)
+				return std::to_string((unsigned long long)integer);
+
+			// SHORTEST ONE BETWEEN 15 AND 17 DIGITS
+			char buffer[32];
+			snprintf(buffer, sizeof(buffer), "%.15g", real);
+			if (std::strtod(buffer, nullptr) != real)
+				snprintf(buffer, sizeof(buffer), "%.17g", real);
+
+			return buffer;
+		};
+
+		auto is_number() const -> bool
+		{
+			return type == INTEGER || type == UNSIGNED_INTEGER || type == REAL;
+		};
+
+		/* ----------------------------------------------------------
+			BINARY HELPERS
+		---------------------------------------------------------- */
+		/**
+		 * @brief Type codes of a parameter in binary data
+		 */
+		enum BinaryType : unsigned char
+		{
+			BINARY_CUSTOM = 0,
+			BINARY_NUMBER = 1, // TEXT OF A NUMBER, ONLY READ FROM FORMER PEERS
+			BINARY_STRING = 2,
+			BINARY_XML = 3,
+			BINARY_BYTE_ARRAY = 4,
+			BINARY_INT64 = 5,
+			BINARY_UINT64 = 6,
+			BINARY_DOUBLE = 7
+		};
+
+		void write_binary(ByteArray &data) const
+		{
+			// TYPE AND NAME
+			unsigned char binary_type;
+			if (type == INTEGER)
+				binary_type = BINARY_INT64;
+			else if (type == UNSIGNED_INTEGER)
+				binary_type = BINARY_UINT64;
+			else if (type == REAL)
+				binary_type = BINARY_DOUBLE;
+			else if (type == STRING)
+				binary_type = BINARY_STRING;
+			else if (type == XML)
+				binary_type = BINARY_XML;
+			else if (type == BYTE_ARRAY)
+				binary_type = BINARY_BYTE_ARRAY;
+			else
+				binary_type = BINARY_CUSTOM;
+
+			data.write(binary_type);
+			write_binary_string(data, name);
+
+			// VALUE, NUMBERS IN 8 BYTES OF BIG ENDIAN
+			if (binary_type == BINARY_INT64 || binary_type == BINARY_UINT64)
+				data.writeReversely(integer);
+			else if (binary_type == BINARY_DOUBLE)
+				data.writeReversely(real);
+			else if (binary_type == BINARY_STRING)
+				write_binary_string(data, str);
+			else if (binary_type == BINARY_XML)
+			{
+				std::shared_ptr<library::XML> value = getValueAsXML();
+				std::string text;
+				if (value != nullptr)
+					value->write(text, true);
+
+				write_binary_string(data, text);
+			}
+			else if (binary_type == BINARY_BYTE_ARRAY)
+			{
+				data.writeReversely((unsigned long long)byte_array.size());
+				data.write(byte_array);
+			}
+			else
+			{
+				write_binary_string(data, custom.type);
+				write_binary_string(data, custom.str);
+			}
+		};
+
+		static void write_binary_string(ByteArray &data, const std::string &str)
+		{
+			data.writeReversely((unsigned int)str.size());
+			data.write(str);
+		};
+
+		template <typename T>
+		static auto read_binary(const ByteArray &data) -> T
+		{
+			check_binary_size(data, sizeof(T));
+
+			return data.readReversely<T>();
+		};
+
+		static auto read_binary_string(const ByteArray &data) -> std::string
+		{
+			size_t size = read_binary<unsigned int>(data);
+			check_binary_size(data, size);
+
+			std::string str((const char*)data.data() + data.get_position(), size);
+			((ByteArray&)data).set_position(data.get_position() + size);
+
+			return str;
+		};
+
+		static void check_binary_size(const ByteArray &data, size_t size)
+		{
+			if (data.get_position() > data.size() || data.left_size() < size)
+				throw std::out_of_range("binary data of the Invoke message is truncated.");
+		};
+
+		static auto empty_string() -> const std::string&
+		{
+			static const std::string str;
+			return str;
+		};
+
 	protected:
 		template <typename T>
 		void construct_by_varadic_template(const T &val)
 		{
-			this->type = "number";
-
+			construct_by_varadic_template(val, std::is_arithmetic<T>());
+		};
+		template <typename T>
+		void construct_by_varadic_template(const T &val, std::true_type)
+		{
+			// NUMBERS ARE KEPT BINARY
+			if (std::is_floating_point<T>::value == true)
+			{
+				set_type(REAL);
+				real = (double)val;
+			}
+			else if (std::is_unsigned<T>::value == true && (unsigned long long)val > (unsigned long long)LLONG_MAX)
+			{
+				set_type(UNSIGNED_INTEGER);
+				integer = (long long)val;
+			}
+			else
+			{
+				set_type(INTEGER);
+				integer = (long long)val;
+			}
+		};
+		template <typename T>
+		void construct_by_varadic_template(const T &val, std::false_type)
+		{
+			// A TYPE EXPRESSED BY A STREAM IS A NUMBER
 			std::stringstream sstream;
 			sstream << val;
 
-			this->str = move(sstream.str());
+			construct_number(sstream.str());
 		};
 		template<> void construct_by_varadic_template(const std::string &str)
 		{
-			this->type = "string";
+			set_type(STRING);
 			this->str = str;
 		};
 		template<> void construct_by_varadic_template(const WeakString &wstr)
 		{
-			this->type = "string";
+			set_type(STRING);
 			this->str = wstr.str();
 		};
 		template<> void construct_by_varadic_template(const ByteArray &byte_array)
 		{
-			this->type = "ByteArray";
+			set_type(BYTE_ARRAY);
 			this->byte_array = byte_array;
 		};
 
 		template<> void construct_by_varadic_template(const std::shared_ptr<library::XML> &xml)
 		{
-			this->type = "XML";
+			set_type(XML);
 			this->xml = xml;
 		};
 
@@ -278,8 +828,35 @@ namespace protocol
 
 		/**
 		 * @brief Get type
+		 *
+		 * @return One of "number", "string", "XML", "ByteArray" or name of a custom type.
 		 */
 		auto getType() const->std::string
+		{
+			switch (type)
+			{
+			case INTEGER:
+			case UNSIGNED_INTEGER:
+			case REAL:
+				return "number";
+			case STRING:
+				return "string";
+			case XML:
+				return "XML";
+			case BYTE_ARRAY:
+				return "ByteArray";
+			default:
+				return custom.type;
+			}
+		};
+
+		/**
+		 * @brief Get type code
+		 *
+		 * @details
+		 * <p> Same with {@link getType getType()}, without comparing strings. </p>
+		 */
+		auto getTypeCode() const -> Type
 		{
 			return type;
 		};
@@ -288,28 +865,40 @@ namespace protocol
 		 * @brief Get value
 		 *
 		 * @tparam _Ty Type of value to get
+		 * @throw std::invalid_argument A number is requested from a value which is not a number.
 		 */
 		template<typename T> auto getValue() const -> T
 		{
-			double val = std::stod(str);
-
-			return (T)val;
+			switch (type)
+			{
+			case INTEGER:
+				return (T)integer;
+			case UNSIGNED_INTEGER:
+				return (T)(unsigned long long)integer;
+			case REAL:
+				return (T)real;
+			default:
+				return (T)std::stod(referValue<std::string>());
+			}
 		};
 		template<> auto getValue() const -> std::string
 		{
-			return str;
+			if (is_number() == true)
+				return format_number();
+			else
+				return referValue<std::string>();
 		};
 		template<> auto getValue() const -> WeakString
 		{
-			return str;
+			return referValue<std::string>();
 		};
 		template<> auto getValue() const -> std::shared_ptr<library::XML>
 		{
-			return xml;
+			return getValueAsXML();
 		};
 		template<> auto getValue() const -> ByteArray
 		{
-			return byte_array;
+			return referValue<ByteArray>();
 		};
 
 		/**
@@ -318,22 +907,93 @@ namespace protocol
 		 */
 		auto getValueAsXML() const -> std::shared_ptr<library::XML>
 		{
-			return xml;
+			if (type != XML)
+				return nullptr;
+			else if (xml_node != nullptr)
+				return xml_node->toXML(); // BUILT FOR EACH REQUEST
+			else
+				return xml;
+		};
+
+		/**
+		 * @brief Get value as a node of XMLDocument
+		 *
+		 * @details
+		 * <p> Returns the node, if the parameter has been constructed from an {@link library::XMLDocument}. 
+		 * Reading the node costs nothing, unlike {@link getValueAsXML getValueAsXML()}. The node is valid while
+		 * this parameter is alive. </p>
+		 *
+		 * @return The node, or nullptr if the value is not kept as a node.
+		 */
+		auto getValueAsNode() const -> const library::XMLNode*
+		{
+			return (type == XML) ? xml_node : nullptr;
+		};
+
+		/**
+		 * @brief Get value as a reader of XML
+		 *
+		 * @details
+		 * <p> Returns a {@link library::XMLReader reader} over the XML value, to construct an {@link Entity} from
+		 * the value in a single pass, without building an {@link library::XML} object. If the parameter has been
+		 * constructed from an {@link library::XMLDocument}, the reader refers to the source of the node directly,
+		 * even if the node is not parsed yet. The reader is valid while this parameter is alive. </p>
+		 *
+		 * @return A reader, or nullptr if the value is not XML.
+		 */
+		auto getValueAsReader() const -> std::unique_ptr<library::XMLReader>
+		{
+			if (type != XML)
+				return nullptr;
+			else if (xml_node != nullptr)
+				return std::unique_ptr<library::XMLReader>(new library::XMLReader(xml_node->getSource()));
+			else if (xml != nullptr)
+			{
+				std::string text;
+				xml->write(text, true);
+
+				return std::unique_ptr<library::XMLReader>(new library::XMLReader(std::move(text)));
+			}
+			else
+				return nullptr;
 		};
 
 		/**
 		 * @brief Reference value
 		 *
+		 * @details
+		 * <p> A number is kept binary, thus it's formatted to a string when referenced first. The string is
+		 * cached, even by concurrent readers, until the value is changed. </p>
+		 *
 		 * @tparam _Ty Type of value to reference
 		 */
 		template <typename T> auto referValue() const -> const T&;
 		template<> auto referValue() const -> const std::string&
 		{
-			return str;
+			if (type == STRING)
+				return str;
+			else if (type == CUSTOM)
+				return custom.str;
+			else if (is_number() == false)
+				return empty_string();
+
+			// FORMAT ONCE, THE FIRST ONE IS KEPT BETWEEN CONCURRENT READERS
+			std::string *cached = number_str.load();
+			if (cached == nullptr)
+			{
+				std::string *formatted = new std::string(format_number());
+				if (number_str.compare_exchange_strong(cached, formatted) == true)
+					cached = formatted;
+				else
+					delete formatted;
+			}
+			return *cached;
 		};
 		template<> auto referValue() const -> const ByteArray&
 		{
-			return byte_array;
+			static const ByteArray empty;
+
+			return (type == BYTE_ARRAY) ? byte_array : empty;
 		};
 
 		/**
@@ -344,10 +1004,20 @@ namespace protocol
 		template <typename T> auto moveValue() -> T;
 		template<> auto moveValue() -> std::string
 		{
-			return move(str);
+			if (type == STRING)
+				return move(str);
+			else if (type == CUSTOM)
+				return move(custom.str);
+			else
+				return getValue<std::string>();
 		};
 		template<> auto moveValue() -> ByteArray
 		{
+			if (type != BYTE_ARRAY)
+				return ByteArray();
+
+			// THE BUFFER IS NOT GIVEN BACK TO THE POOL ANYMORE
+			byte_array_borrowed = false;
 			return move(byte_array);
 		};
 
@@ -366,17 +1036,37 @@ namespace protocol
 
 			if (name.empty() == false)
 				xml->setProperty("name", name);
-			xml->setProperty("type", type);
+			xml->setProperty("type", getType());
 
-			if (type == "XML")
-				xml->push_back(this->xml);
-			else if (type == "ByteArray")
+			if (type == XML)
+				xml->push_back(getValueAsXML());
+			else if (type == BYTE_ARRAY)
 				xml->setValue(byte_array.size());
+			else if (is_number() == true)
+				xml->setValue(format_number());
 			else
-				xml->setValue(str);
+				xml->setValue(referValue<std::string>());
 
 			return xml;
 		};
+
+		/**
+		 * @brief Get binary data represents the parameter
+		 *
+		 * @details
+		 * <p> Returns binary data, a compact alternative of {@link toXML toXML()}, which can be restored by
+		 * {@link construct construct(const ByteArray&)}. Name, type and value are written with their length
+		 * prefixed. A number is written in 8 bytes, without formatting, and a ByteArray value is written inline. </p>
+		 *
+		 * @return Binary data represents the parameter.
+		 */
+		auto toByteArray() const -> ByteArray
+		{
+			ByteArray data;
+			write_binary(data);
+
+			return data;
+		};
 	};
 };
-};
\ No newline at end of file
+};
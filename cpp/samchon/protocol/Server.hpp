@@ -4,6 +4,8 @@
 #include <samchon/protocol/ClientDriver.hpp>
 
 #include <thread>
+#include <vector>
+#include <algorithm>
 
 namespace samchon
 {
@@ -47,12 +49,17 @@ namespace protocol
 	protected:
 		std::unique_ptr<boost::asio::ip::tcp::acceptor> _Acceptor;
 
+	private:
+		std::unique_ptr<boost::asio::io_service> io_service;
+		size_t pool_size;
+
 	public:
 		/**
 		 * Default Constructor.
 		 */
 		Server()
 		{
+			pool_size = std::max<size_t>(std::thread::hardware_concurrency(), 1);
 		};
 
 		/**
@@ -69,6 +76,11 @@ namespace protocol
 		/**
 		 * Open server.
 		 * 
+		 * Opens the server and accepts remote clients. Accepting and communicating with the clients are done on a pool 
+		 * of threads, whose size can be specified by {@link setPoolSize setPoolSize()}. The thread calling this method 
+		 * also joins the pool, thus this method returns after the server is {@link close closed} and all the 
+		 * connections are closed.
+		 * 
 		 * @param port Port number to open.
 		 */
 		virtual void open(int port)
@@ -76,26 +88,45 @@ namespace protocol
 			if (_Acceptor != nullptr && _Acceptor->is_open())
 				return;
 
-			boost::asio::io_service io_service;
 			boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::tcp::v4(), port);
-			boost::system::error_code error;
 
-			_Acceptor.reset(new boost::asio::ip::tcp::acceptor(io_service, endpoint));
+			io_service.reset(new boost::asio::io_service());
+			_Acceptor.reset(new boost::asio::ip::tcp::acceptor(*io_service, endpoint));
 
-			while (true)
+			if (pool_size == 0)
 			{
-				std::shared_ptr<boost::asio::ip::tcp::socket> socket(new boost::asio::ip::tcp::socket(io_service));
-				_Acceptor->accept(*socket);
+				// A THREAD PER CONNECTION
+				while (true)
+				{
+					std::shared_ptr<boost::asio::ip::tcp::socket> socket(new boost::asio::ip::tcp::socket(*io_service));
+					boost::system::error_code error;
 
-				if (error)
-					break;
+					_Acceptor->accept(*socket, error);
+					if (error)
+						break;
 
-				std::thread(&Server::handle_connection, this, socket).detach();
+					std::thread(&Server::handle_connection, this, socket).detach();
+				}
+			}
+			else
+			{
+				// ACCEPT AND COMMUNICATE ASYNCHRONOUSLY ON THE THREAD POOL
+				accept_async();
+
+				std::vector<std::thread> threads;
+				for (size_t i = 1; i < pool_size; i++)
+					threads.emplace_back(&Server::run_service, this);
+
+				run_service();
+				for (size_t i = 0; i < threads.size(); i++)
+					threads[i].join();
 			}
 		};
 
 		/**
 		 * Close the server.
+		 * 
+		 * Stops accepting remote clients. Connections with the clients already accepted are not closed.
 		 */
 		virtual void close()
 		{
@@ -106,6 +137,32 @@ namespace protocol
 			_Acceptor->close();
 		};
 
+		/**
+		 * Set size of the thread pool.
+		 * 
+		 * Sets number of threads accepting and communicating with remote clients asynchronously. Default size is number 
+		 * of the hardware threads. If the *size* is zero, the server goes back to the old way; a thread is created 
+		 * for each connection and the thread is blocked during the connection.
+		 * 
+		 * Note that, the size must be specified before {@link open opening} the server.
+		 * 
+		 * @param size Number of threads in the pool, zero means a thread per connection.
+		 */
+		void setPoolSize(size_t size)
+		{
+			pool_size = size;
+		};
+
+		/**
+		 * Get size of the thread pool.
+		 * 
+		 * @return Number of threads in the pool, zero means a thread per connection.
+		 */
+		auto getPoolSize() const -> size_t
+		{
+			return pool_size;
+		};
+
 	protected:
 		/**
 		 * Add a newly connected remote client.
@@ -126,10 +183,73 @@ namespace protocol
 		 */
 		virtual void addClient(std::shared_ptr<ClientDriver>) = 0; //ADD_CLIENT
 
+		/**
+		 * @hidden
+		 */
+		void _Add_client(std::shared_ptr<ClientDriver> driver)
+		{
+			// LISTENING IN THE POOL DOESN'T BLOCK
+			driver->asynchronous = (pool_size != 0);
+
+			// MESSAGES SENT IN THE ADD_CLIENT ARE WRITTEN ASYNCHRONOUSLY, HOLDING THE DRIVER
+			driver->set_self(driver);
+
+			addClient(driver);
+		};
+
+		/**
+		 * @hidden
+		 *
+		 * Get the io_service run by the thread pool, to schedule timers.
+		 *
+		 * @return The io_service, or nullptr if a thread is created for each connection.
+		 */
+		auto _Get_io_service() const -> boost::asio::io_service*
+		{
+			return (pool_size == 0) ? nullptr : io_service.get();
+		};
+
 	private:
 		virtual void handle_connection(std::shared_ptr<boost::asio::ip::tcp::socket> socket)
 		{
-			addClient(std::make_shared<ClientDriver>(socket));
+			_Add_client(std::make_shared<ClientDriver>(socket));
+		};
+
+		void accept_async()
+		{
+			std::shared_ptr<boost::asio::ip::tcp::socket> socket(new boost::asio::ip::tcp::socket(*io_service));
+
+			_Acceptor->async_accept(*socket, [this, socket](const boost::system::error_code &error)
+			{
+				// ACCEPTOR HAS CLOSED
+				if (_Acceptor->is_open() == false)
+					return;
+
+				// ACCEPT NEXT CLIENT
+				accept_async();
+
+				if (!error)
+					handle_connection(socket);
+			});
+		};
+
+		void run_service()
+		{
+			while (true)
+			{
+				try
+				{
+					io_service->run();
+					break;
+				}
+				catch (std::exception &e)
+				{
+					std::cout << "Uncaught exception in the server: " << e.what() << std::endl;
+				}
+				catch (...)
+				{
+				}
+			}
 		};
 	};
 };
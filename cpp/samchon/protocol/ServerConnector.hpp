@@ -87,6 +87,7 @@ namespace protocol
 		virtual void connect(const std::string &ip, int port)
 		{
 			_Connect(ip, port);
+			request_binary_mode();
 
 			listen_message();
 		};
@@ -26,6 +26,8 @@ namespace protocol
 		virtual void construct(std::shared_ptr<library::XML> xml)
 		{
 			clear();
+			EntityBase::construct(xml); // FIELDS DECLARED BY ARCHIVE()
+
 			if (xml->has(CHILD_TAG()) == false)
 				return;
 
@@ -37,6 +39,45 @@ namespace protocol
 				it->construct(xml_list->at(i++));
 		};
 
+		/**
+		 * @brief Construct data of the Entity from binary data
+		 *
+		 * @details
+		 * <p> Loads fields declared by archive(), and then the children; number of them and each child's own binary
+		 * data. </p>
+		 *
+		 * <p> Number of the children is told by the data, thus it's verified not to exceed the data left. Each child 
+		 * must read a byte at least. </p>
+		 *
+		 * \par [Inherited]
+		 *		@copydoc EntityBase::construct(const ByteArray&)
+		 */
+		virtual void construct(const ByteArray &data) override
+		{
+			clear();
+			EntityBase::construct(data);
+
+			unsigned long long size = 0;
+			EntityArchive archive(EntityArchive::LOAD, (ByteArray&)data);
+			archive.field(CHILD_TAG(), size);
+
+			// THE SIZE IS TOLD BY THE DATA; EACH CHILD TAKES A BYTE AT LEAST
+			if (size > data.left_size())
+				throw std::out_of_range("number of children exceeds the binary data.");
+
+			for (unsigned long long i = 0; i < size; i++)
+			{
+				size_t position = data.get_position();
+				emplace_back();
+
+				EntityBase &base = this->back();
+				base.construct(data);
+
+				if (data.get_position() == position)
+					throw std::invalid_argument("a child has not read its binary data.");
+			}
+		};
+
 		/* ------------------------------------------------------------------------------------
 			ACCESSORS
 		------------------------------------------------------------------------------------ */
@@ -222,6 +263,27 @@ namespace protocol
 			xml->set(CHILD_TAG(), xmlList);
 			return xml;
 		};
+
+		/**
+		 * @brief Write binary data represents the EntityGroup
+		 *
+		 * @details
+		 * <p> Writes fields declared by archive(), and then number of children and each child's binary data. </p>
+		 *
+		 * \par [Inherited]
+		 *		@copydoc EntityBase::writeByteArray()
+		 */
+		virtual void writeByteArray(ByteArray &data) const override
+		{
+			EntityBase::writeByteArray(data);
+
+			unsigned long long size = this->size();
+			EntityArchive archive(EntityArchive::SAVE, data);
+			archive.field(CHILD_TAG(), size);
+
+			for (auto it = begin(); it != end(); it++)
+				it->writeByteArray(data);
+		};
 	};
 };
 };
\ No newline at end of file
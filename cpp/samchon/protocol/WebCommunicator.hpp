@@ -6,6 +6,7 @@
 #include <exception>
 #include <queue>
 #include <samchon/protocol/WebSocketUtil.hpp>
+#include <samchon/protocol/WebSocketDeflate.hpp>
 
 namespace samchon
 {
@@ -38,35 +39,121 @@ namespace protocol
 	private:
 		bool is_server;
 
+		/**
+		 * Messages smaller than this size are not compressed; deflating them costs more than it saves.
+		 */
+		static const size_t MIN_DEFLATE_SIZE = 128;
+
+		/**
+		 * Size of the buffer masking data while being written.
+		 */
+		static const size_t MASK_BUFFER_SIZE = 64 * 1024;
+
+		/**
+		 * Maximum payload size of a frame to send. Larger messages are fragmented, so that control frames can be 
+		 * written between the fragments.
+		 */
+		static const size_t MAX_FRAGMENT_SIZE = 64 * 1024;
+
+		std::vector<unsigned char> mask_buffer;
+
+		/**
+		 * Header of a frame being read.
+		 */
+		struct FrameHeader
+		{
+			unsigned char op_code;
+			bool fin;
+			bool compressed;
+			size_t size;
+			size_t size_bytes_length;
+			std::array<unsigned char, 4> mask;
+		};
+		FrameHeader frame;
+
+		/**
+		 * State of a message being read, which can be fragmented into several frames.
+		 */
+		unsigned char message_op_code;
+		bool message_compressed;
+		bool message_streamed;
+		size_t message_size;
+		ByteArray message_buffer;
+		ByteArray *message_destination;
+
+	protected:
+		/**
+		 * Compressor of the *permessage-deflate* extension, if negotiated in the handshake.
+		 */
+		std::unique_ptr<WebSocketDeflate> compressor;
+
 	public:
 		WebCommunicator(bool is_server)
 			: Communicator()
 		{
 			this->is_server = is_server;
+
+			message_op_code = 0;
+			message_compressed = false;
+			message_streamed = false;
+			message_size = 0;
+			message_destination = nullptr;
 		};
 		virtual ~WebCommunicator() = default;
 
-		virtual void sendData(std::shared_ptr<Invoke> invoke) override
+		/**
+		 * Test whether messages are compressed.
+		 *
+		 * @return Whether the *permessage-deflate* extension has been negotiated in the handshake.
+		 */
+		auto isCompressed() const -> bool
 		{
-			std::unique_lock<std::mutex> uk(send_mtx);
+			return compressor != nullptr;
+		};
 
-			// SEND INVOKE
-			const std::string &str = invoke->toXML()->toString();
-			if (is_server == true)
-				send_data(str);
-			else // CLIENT MASKS ON SENDING DATA
-				send_masked_data(str);
+	protected:
+		virtual auto encode_message(std::shared_ptr<Invoke> invoke) -> std::shared_ptr<OutboundMessage> override
+		{
+			std::shared_ptr<InvokeFrame> frame = invoke->_Get_frame();
 
-			// SEND BINARY
-			for (size_t i = 0; i < invoke->size(); i++)
-				if (invoke->at(i)->getType() == "ByteArray")
-					if (is_server == true)
-						send_data(invoke->at(i)->referValue<ByteArray>());
-					else // CLIENT MASKS ON SENDING DATA
-						send_masked_data(invoke->at(i)->referValue<ByteArray>());
+			// FRAMES OF A SERVER ARE NOT MASKED; WITHOUT COMPRESSION, SHARED BY ALL THE PEERS OF A BROADCAST
+			if (frame != nullptr && is_server == true && compressor == nullptr)
+				return share_message(invoke, frame->fetch<OutboundMessage>(InvokeFrame::WEB_SOCKET_FRAME, [this, &invoke]() -> std::shared_ptr<OutboundMessage>
+				{
+					std::shared_ptr<OutboundMessage> prototype(new OutboundMessage());
+					prototype->invoke = invoke;
+					write_text(invoke, prototype->text);
+
+					gather_message(*prototype);
+					prototype->invoke = nullptr; // THE INVOKE HOLDS THE FRAME
+
+					return prototype;
+				}));
+
+			std::shared_ptr<OutboundMessage> message(new OutboundMessage());
+			message->invoke = invoke;
+			write_text(invoke, message->text);
+
+			// WITH CONTEXT OF COMPRESSION, FRAMES ARE GATHERED IN ORDER OF SENDING
+			if (compressor == nullptr)
+				gather_message(*message);
+
+			return message;
+		};
+
+		virtual void prepare_message(OutboundMessage &message) override
+		{
+			if (compressor != nullptr && message.buffers.empty() == true)
+				gather_message(message);
+		};
+
+		/**
+		 * Web-socket peers, often web browsers, understand only XML. Binary mode is not requested.
+		 */
+		virtual void request_binary_mode() override
+		{
 		};
 
-	protected:
 		/* =========================================================
 			SOCKET I/O
 				- READ
@@ -76,257 +163,497 @@ namespace protocol
 		--------------------------------------------------------- */
 		virtual void listen_message() override
 		{
-			std::shared_ptr<Invoke> binary_invoke = nullptr;
-			std::queue<std::shared_ptr<InvokeParameter>> binary_parameters;
-
 			while (true)
 			{
 				try
 				{
-					const std::pair<unsigned char, size_t> &header = listen_header();
-
-					// EXIT CODE
-					if (header.first == WebSocketUtil::DISCONNECT)
+					// READ HEADER
+					size_t extension_size = parse_frame_header(listen_view(2));
+					parse_frame_extension(listen_view(extension_size));
+
+					// READ PAYLOAD, DIRECTLY INTO ITS DESTINATION OR AS A VIEW
+					unsigned char *data = prepare_payload();
+					if (data == nullptr)
+						data = listen_view(frame.size);
+					else
+						listen_data(data, frame.size);
+
+					// THE SOCKET IS CLOSED AFTER THE CLOSE FRAME IS WRITTEN
+					if (handle_frame(data) == false)
 						break;
-
-					// READ DATA
-					if (header.first == WebSocketUtil::TEXT)
-					{
-						std::shared_ptr<Invoke> invoke = listen_string(header.second);
-
-						for (size_t i = 0; i < invoke->size(); i++)
-						{
-							std::shared_ptr<InvokeParameter> &parameter = invoke->at(i);
-							if (parameter->getType() != "ByteArray")
-								continue;
-
-							if (binary_invoke == nullptr)
-								binary_invoke = invoke;
-							binary_parameters.push(parameter);
-						}
-
-						// NO BINARY, THEN REPLY DIRECTLY
-						if (binary_invoke == nullptr)
-							this->replyData(invoke);
-					}
-					else if (header.first == WebSocketUtil::BINARY)
-					{
-						std::shared_ptr<InvokeParameter> parameter = binary_parameters.front();
-						listen_binary(header.second, parameter);
-						binary_parameters.pop();
-
-						if (binary_parameters.empty() == true)
-						{
-							// NO BINARY PARAMETER LEFT,
-							std::shared_ptr<Invoke> invoke = binary_invoke;
-							binary_invoke = nullptr;
-
-							// THEN REPLY
-							this->replyData(invoke);
-						}
-					}
 				}
 				catch (...)
 				{
+					close();
 					break;
 				}
 			}
+			handle_close();
 		};
 
-	private:
-		auto listen_header() -> std::pair<unsigned char, size_t>
+		virtual void listen_message_async() override
 		{
-			unsigned char mask = is_server ? WebSocketUtil::MASK : 0;
+			// READ HEADER BYTES
+			listen_view_async(2, [this](unsigned char *header_bytes)
+			{
+				size_t extension_size = parse_frame_header(header_bytes);
 
-			std::array<unsigned char, 2> header_bytes;
-			unsigned char op_code; // false then binary
-			unsigned char size_header;
+				// SIZE BYTES FOLLOWED BY MASK
+				listen_view_async(extension_size, [this](unsigned char *extension)
+				{
+					parse_frame_extension(extension);
 
-			size_t content_size = 0;
+					// READ PAYLOAD, DIRECTLY INTO ITS DESTINATION OR AS A VIEW
+					unsigned char *destination = prepare_payload();
+					if (destination == nullptr)
+						listen_view_async(frame.size, [this](unsigned char *data)
+						{
+							handle_frame_async(data);
+						}, false);
+					else
+						listen_data_async(boost::asio::buffer(destination, frame.size), [this, destination]()
+						{
+							handle_frame_async(destination);
+						}, false);
+				}, false);
+			}, false);
+		};
 
-			// READ HEADER BYTES
-			listen_data(header_bytes);
-			op_code = header_bytes[0];
-			size_header = header_bytes[1];
+	private:
+		/**
+		 * Parse first two bytes of a frame.
+		 *
+		 * @return Number of following bytes of the header; extended size and mask.
+		 */
+		auto parse_frame_header(const unsigned char *header_bytes) -> size_t
+		{
+			unsigned char size_header = header_bytes[1];
+
+			frame.op_code = (header_bytes[0] & WebSocketUtil::OP_CODE_BITS) | WebSocketUtil::FIN;
+			frame.fin = (header_bytes[0] & WebSocketUtil::FIN) != 0;
+			frame.compressed = (header_bytes[0] & WebSocketUtil::RSV1) != 0;
 
 			// INSPECT MASK VALIDATION
 			if (is_server == true)
 			{
 				if (size_header < WebSocketUtil::MASK)
-					throw std::domain_error("masked message from server has delivered.");
+					throw std::domain_error("unmasked message from client has delivered.");
+				size_header -= WebSocketUtil::MASK; // CLIENT SENDS MASKED DATA, DETACH THE MASK
 			}
-			else
+			else if (size_header >= WebSocketUtil::MASK)
+				throw std::domain_error("masked message from server has delivered.");
+
+			// CONTROL FRAME CAN'T BE FRAGMENTED
+			if ((frame.op_code & WebSocketUtil::CONTROL_BIT) && (frame.fin == false || size_header > 125))
+				throw std::domain_error("invalid control frame has delivered.");
+
+			frame.size_bytes_length = 0;
+			frame.size = size_header;
+
+			if (size_header == (unsigned char)WebSocketUtil::TWO_BYTES)
+				frame.size_bytes_length = 2;
+			else if (size_header == (unsigned char)WebSocketUtil::EIGHT_BYTES)
+				frame.size_bytes_length = 8;
+
+			return frame.size_bytes_length + (is_server ? 4 : 0);
+		};
+
+		/**
+		 * Parse extended size and mask of a frame.
+		 */
+		void parse_frame_extension(const unsigned char *extension)
+		{
+			// READ CONTENT SIZE
+			if (frame.size_bytes_length != 0)
 			{
-				if (size_header >= WebSocketUtil::MASK)
-					throw std::domain_error("masked message from server has delivered.");
+				frame.size = 0;
+				for (size_t c = 0; c < frame.size_bytes_length; c++)
+					frame.size = (frame.size << 8) | extension[c];
 			}
 
-			// EXIT CODE
-			if (op_code == WebSocketUtil::DISCONNECT)
-				return{ op_code, 0 }; // DISCONNECTION SIGNAL HAS ARRIVED
+			// READ MASK
+			if (is_server == true)
+				for (size_t i = 0; i < frame.mask.size(); i++)
+					frame.mask[i] = extension[frame.size_bytes_length + i];
+		};
 
-									  // READ CONTENT SIZE
-			if (is_server)
-				size_header -= WebSocketUtil::MASK; // CLIENT SENDS MASKED DATA, DETACH THE MASK
+		/**
+		 * Prepare destination of the payload of a data frame.
+		 *
+		 * Payloads of fragmented messages are gathered into the {@link message_buffer}, except binary data of a 
+		 * {@link ByteArray} parameter, which are streamed into the parameter directly.
+		 *
+		 * @return Pointer to read the payload into, *nullptr* if the payload can be read as a view.
+		 */
+		auto prepare_payload() -> unsigned char*
+		{
+			// CONTROL FRAME, READ AS A VIEW
+			if (frame.op_code & WebSocketUtil::CONTROL_BIT)
+				return nullptr;
 
-			if (size_header == (unsigned char)WebSocketUtil::TWO_BYTES)
+			if (frame.op_code != WebSocketUtil::CONTINUATION)
 			{
-				// SIZE HEADER IS 2 BYTES
-				std::array<unsigned char, 2> size_bytes;
-				listen_data(size_bytes);
+				// FIRST FRAME OF A MESSAGE
+				if (message_op_code != 0)
+					throw std::domain_error("a message has delivered before the previous message ends.");
+
+				if (frame.size > getMaxMessageSize())
+					throw std::length_error("too large message has delivered.");
+
+				message_op_code = frame.op_code;
+				message_compressed = frame.compressed;
+				message_size = 0;
+				message_streamed = frame.op_code == WebSocketUtil::BINARY
+					&& frame.compressed == false
+					&& has_binary_parameter() == true;
+
+				// WHOLE MESSAGE IN A FRAME
+				if (message_streamed == true)
+				{
+					message_destination = &front_binary_parameter()->borrowByteArray(frame.size);
+					message_size = frame.size;
 
-				for (size_t c = 0; c < size_bytes.size(); c++)
-					content_size += size_bytes[c] << (8 * (size_bytes.size() - 1 - c));
+					return message_destination->data();
+				}
+				else if (frame.fin == true)
+					return nullptr;
 			}
-			else if (size_header == (unsigned char)WebSocketUtil::EIGHT_BYTES)
+			else if (message_op_code == 0)
+				throw std::domain_error("continuation frame without a message has delivered.");
+
+			// THE SIZE IS TOLD BY THE REMOTE SYSTEM
+			if (frame.size > getMaxMessageSize() - message_size)
+				throw std::length_error("too large message has delivered.");
+
+			// APPEND THE FRAGMENT
+			ByteArray &buffer = (message_streamed == true) ? *message_destination : message_buffer;
+			buffer.resize(message_size + frame.size);
+
+			unsigned char *destination = buffer.data() + message_size;
+			message_size += frame.size;
+
+			return destination;
+		};
+
+		/**
+		 * Handle a frame whose payload has been read.
+		 *
+		 * @param data Payload of the frame.
+		 * @return Whether to keep listening; false if the connection is closing.
+		 */
+		auto handle_frame(unsigned char *data) -> bool
+		{
+			// UNMASK IN PLACE
+			if (is_server == true)
+				unmask_data(data, frame.size, frame.mask);
+
+			if (frame.op_code & WebSocketUtil::CONTROL_BIT)
+				return handle_control(data, frame.size);
+			else if (frame.fin == false)
+				return true; // WAIT FOLLOWING FRAGMENTS
+
+			// THE MESSAGE IS COMPLETED
+			unsigned char op_code = message_op_code;
+			message_op_code = 0;
+
+			if (message_streamed == true)
+			{
+				message_destination = nullptr;
+				handle_binary();
+			}
+			else if (frame.op_code == WebSocketUtil::CONTINUATION)
 			{
-				// SIZE HEADER IS 8 BYTES
-				std::array<unsigned char, 8> size_bytes;
-				listen_data(size_bytes);
+				handle_data(op_code, message_compressed, message_buffer.data(), message_size);
 
-				for (size_t c = 0; c < size_bytes.size(); c++)
-					content_size += size_bytes[c] << (8 * (size_bytes.size() - 1 - c));
+				message_buffer.clear();
+				message_buffer.shrink_to_fit();
 			}
 			else
-				content_size = (size_t)size_header;
+				handle_data(op_code, message_compressed, data, frame.size);
 
-			return{ op_code, content_size };
+			return true;
 		};
 
-		auto listen_string(size_t size) -> std::shared_ptr<Invoke>
+		void handle_frame_async(unsigned char *data)
 		{
-			// READ CONTENT
-			std::string data(size, (char)NULL);
-			if (is_server) // CLIENT SENDS MASKED DATA
-				listen_masked_data(data);
+			if (handle_frame(data) == true)
+				listen_message_async();
 			else
-				listen_data(data);
-
-			// CONSTRUCT INVOKE OBJECT
-			std::shared_ptr<Invoke> invoke(new Invoke());
-			invoke->construct(std::make_shared<library::XML>(data));
-
-			return invoke;
+				handle_close(); // THE SOCKET IS CLOSED AFTER THE CLOSE FRAME IS WRITTEN
 		};
 
-		void listen_binary(size_t size, std::shared_ptr<InvokeParameter> parameter)
+		void handle_data(unsigned char op_code, bool compressed, const unsigned char *data, size_t size)
 		{
-			// FETCH BYTE_ARRAY
-			ByteArray &data = (ByteArray&)parameter->referValue<ByteArray>();
+			if (compressed == true)
+			{
+				ByteArray content = inflate_message(data, size);
+				handle_data(op_code, false, content.data(), content.size());
+			}
+			else if (op_code == WebSocketUtil::TEXT)
+				handle_string(construct_invoke(data, size));
+			else if (op_code == WebSocketUtil::BINARY && has_binary_parameter() == true)
+			{
+				ByteArray &byte_array = front_binary_parameter()->borrowByteArray(size);
+				memcpy(byte_array.data(), data, size);
 
-			// READ CONTENT
-			if (is_server == true) // CLIENT SENDS MASKED DATA
-				listen_masked_data(data);
-			else
-				listen_data(data);
+				handle_binary();
+			}
+			// OTHERWISE, NOT A MESSAGE TO HANDLE
 		};
 
-		template <class Container>
-		void listen_data(Container &data)
+		/**
+		 * Handle a control frame.
+		 *
+		 * @return Whether to keep listening; false if the connection is closing.
+		 */
+		auto handle_control(const unsigned char *data, size_t size) -> bool
 		{
-			size_t completed = 0;
+			if (frame.op_code == WebSocketUtil::PING)
+				send_control(WebSocketUtil::PONG, data, size);
+			else if (frame.op_code == WebSocketUtil::DISCONNECT)
+			{
+				// ANSWER WITH THE STATUS CODE, THEN CLOSE
+				try
+				{
+					send_control(WebSocketUtil::DISCONNECT, data, std::min<size_t>(size, 2), true);
+				}
+				catch (...)
+				{
+					close();
+				}
 
-			if (completed < data.size())
-				completed += socket->read_some(boost::asio::buffer((unsigned char*)data.data() + completed, data.size() - completed));
+				return false;
+			}
+			return true;
 		};
 
-		template <class Container>
-		void listen_masked_data(Container &data)
+		auto inflate_message(const unsigned char *data, size_t size) -> ByteArray
 		{
-			// READ MASK
-			std::array<unsigned char, 4> mask;
-			socket->read_some(boost::asio::buffer(mask));
+			if (compressor == nullptr)
+				throw std::domain_error("compressed message without permessage-deflate has delivered.");
 
-			// READ DATA
-			listen_data(data);
+			return compressor->decompress(data, size, getMaxMessageSize());
+		};
 
-			// UNMASK
-			for (size_t i = 0; i < data.size(); i++)
-				data[i] = data[i] ^ mask[i % 4];
+		static void unmask_data(unsigned char *data, size_t size, const std::array<unsigned char, 4> &mask)
+		{
+			// IN PLACE
+			WebSocketUtil::mask(data, data, size, mask);
 		};
 
 		/* ---------------------------------------------------------
 			WRITE
 		--------------------------------------------------------- */
-		template <class Container>
-		void send_data(const Container &data)
+		/**
+		 * Send a control frame, prior to queued messages.
+		 *
+		 * @param closing Whether to close the connection after the frame is written.
+		 */
+		void send_control(unsigned char op_code, const unsigned char *data, size_t size, bool closing = false)
 		{
-			unsigned char op_code = std::is_same<std::string, Container>()
-				? WebSocketUtil::TEXT
-				: WebSocketUtil::BINARY;
-			size_t size = data.size();
+			std::shared_ptr<OutboundMessage> message(new OutboundMessage());
+			message->text.assign((const char*)data, size);
+			message->urgent = true;
+			message->closing = closing;
 
-			///////
-			// SEND HEADER
-			///////
-			ByteArray header;
-			header.write(op_code);
+			message->headers.resize(1);
+			gather_frame(*message, 0, op_code, (const unsigned char*)message->text.data(), message->text.size());
 
-			if (size < 126)
-				header.write((unsigned char)size);
-			else if (size < 0xFFFF)
+			send_message(message);
+		};
+
+		void gather_message(OutboundMessage &message)
+		{
+			struct Payload
 			{
-				header.write((unsigned char)(WebSocketUtil::TWO_BYTES));
-				header.writeReversely((unsigned short)size);
-			}
-			else
+				unsigned char op_code;
+				const unsigned char *data;
+				size_t size;
+			};
+			std::shared_ptr<Invoke> &invoke = message.invoke;
+
+			// PAYLOADS; INVOKE AND ITS BINARIES
+			std::vector<Payload> payloads;
+			payloads.push_back({ WebSocketUtil::TEXT, (const unsigned char*)message.text.data(), message.text.size() });
+
+			for (size_t i = 0; i < invoke->size(); i++)
+				if (invoke->at(i)->getTypeCode() == InvokeParameter::BYTE_ARRAY)
+				{
+					const ByteArray &byte_array = invoke->at(i)->referValue<ByteArray>();
+					payloads.push_back({ WebSocketUtil::BINARY, byte_array.data(), byte_array.size() });
+				}
+
+			// COMPRESS BY PERMESSAGE-DEFLATE
+			if (compressor != nullptr)
 			{
-				header.write((unsigned char)(WebSocketUtil::EIGHT_BYTES));
-				header.writeReversely((unsigned long long)size);
+				message.compressed_bodies.resize(payloads.size());
+
+				for (size_t i = 0; i < payloads.size(); i++)
+				{
+					Payload &payload = payloads[i];
+					if (payload.size < MIN_DEFLATE_SIZE)
+						continue;
+
+					ByteArray &compressed = message.compressed_bodies[i];
+					compressed = compressor->compress(payload.data, payload.size);
+
+					payload.op_code |= WebSocketUtil::RSV1;
+					payload.data = compressed.data();
+					payload.size = compressed.size();
+				}
 			}
 
-			socket->write_some(boost::asio::buffer(header)); // SEND HEADER
-			socket->write_some(boost::asio::buffer(data)); // SEND DATA
+			// COUNT FRAMES, LARGE PAYLOADS ARE FRAGMENTED
+			size_t count = 0;
+			for (size_t i = 0; i < payloads.size(); i++)
+				count += std::max<size_t>(1, (payloads[i].size + MAX_FRAGMENT_SIZE - 1) / MAX_FRAGMENT_SIZE);
+
+			message.headers.resize(count);
+
+			// GATHER THEM, CLIENT MASKS ON SENDING DATA
+			for (size_t i = 0, index = 0; i < payloads.size(); i++)
+			{
+				const Payload &payload = payloads[i];
+				size_t offset = 0;
+
+				do
+				{
+					size_t piece_size = std::min(payload.size - offset, MAX_FRAGMENT_SIZE);
+
+					// OP_CODE ONLY IN THE FIRST FRAME, FIN ONLY IN THE LAST FRAME
+					unsigned char first_byte = (offset == 0)
+						? (payload.op_code & ~WebSocketUtil::FIN)
+						: (WebSocketUtil::CONTINUATION & ~WebSocketUtil::FIN);
+					if (offset + piece_size == payload.size)
+						first_byte |= WebSocketUtil::FIN;
+
+					message.boundaries.push_back(message.buffers.size());
+					gather_frame(message, index++, first_byte, payload.data + offset, piece_size);
+
+					offset += piece_size;
+				}
+				while (offset < payload.size);
+			}
 		};
 
-		template <class Container>
-		void send_masked_data(const Container &data)
+		void gather_frame(OutboundMessage &message, size_t index, unsigned char first_byte, const unsigned char *data, size_t data_size)
 		{
-			unsigned char op_code = std::is_same<std::string, Container>()
-				? WebSocketUtil::TEXT
-				: WebSocketUtil::BINARY;
-			size_t size = data.size();
+			bool masked = !is_server;
+			unsigned char mask_bit = masked ? WebSocketUtil::MASK : 0;
+			unsigned long long size = data_size;
+
+			std::array<unsigned char, 14> &header = message.headers[index];
+			size_t length;
 
 			///////
-			// SEND HEADER
+			// HEADER
 			///////
-			ByteArray header;
-			header.write(op_code);
+			header[0] = first_byte;
 
 			if (size < 126)
-				header.write((unsigned char)(size + WebSocketUtil::MASK));
-			else if (size < 0xFFFF)
 			{
-				header.write((unsigned char)(WebSocketUtil::TWO_BYTES + WebSocketUtil::MASK));
-				header.writeReversely((unsigned short)size);
+				header[1] = (unsigned char)(size + mask_bit);
+				length = 2;
+			}
+			else if (size <= 0xFFFF)
+			{
+				header[1] = (unsigned char)(WebSocketUtil::TWO_BYTES + mask_bit);
+				header[2] = (unsigned char)(size >> 8);
+				header[3] = (unsigned char)(size & 0xFF);
+				length = 4;
 			}
 			else
 			{
-				header.write((unsigned char)(WebSocketUtil::EIGHT_BYTES + WebSocketUtil::MASK));
-				header.writeReversely((unsigned long long)size);
+				header[1] = (unsigned char)(WebSocketUtil::EIGHT_BYTES + mask_bit);
+				for (size_t c = 0; c < 8; c++)
+					header[2 + c] = (unsigned char)(size >> (8 * (7 - c)));
+				length = 10;
+			}
+
+			message.size += length + data_size;
+
+			if (masked == false)
+			{
+				message.buffers.push_back(boost::asio::buffer(header.data(), length));
+				message.buffers.push_back(boost::asio::buffer(data, data_size));
+				return;
 			}
 
 			///////
-			// SEND DATA
+			// MASK
 			///////
-			static std::uniform_int_distribution<unsigned short> distribution(0, 255);
-			static std::random_device device;
+			// SENDERS ENCODE WITHOUT LOCK, THUS AN ENGINE FOR EACH THREAD, SEEDED ONCE
+			static thread_local std::mt19937 engine(std::random_device{}());
+			uint32_t random = (uint32_t)engine();
 
-			// CONSTRUCT MASK
+			// CONSTRUCT MASK, FOLLOWING THE HEADER
 			std::array<unsigned char, 4> mask;
 			for (size_t i = 0; i < mask.size(); i++)
-				mask[i] = (unsigned char)distribution(device);
+				header[length++] = mask[i] = (unsigned char)(random >> (8 * i));
+			message.size += mask.size();
+
+			// TO BE MASKED WHILE BEING WRITTEN
+			message.buffers.push_back(boost::asio::buffer(header.data(), length));
+			message.masks.push_back({ message.buffers.size(), mask });
+			message.buffers.push_back(boost::asio::buffer(data, data_size));
+		};
 
-			// TO BE MASKED
-			std::vector<unsigned char> masked_data(data.size());
-			for (size_t i = 0; i < masked_data.size(); i++)
-				masked_data[i] = data[i] ^ mask[i % 4];
+		/**
+		 * Write messages, masking data of a client.
+		 *
+		 * Data to be masked are not copied as a whole. They're masked into the {@link mask_buffer} chunk by chunk and 
+		 * written when the buffer is full. Note that, only clients mask, and clients, {@link WebServerConnector}, write 
+		 * synchronously.
+		 */
+		virtual void write_messages(const std::vector<boost::asio::const_buffer> &buffers, const std::vector<const std::array<unsigned char, 4>*> &masks) override
+		{
+			if (is_server == true)
+			{
+				Communicator::write_messages(buffers, masks);
+				return;
+			}
+
+			if (mask_buffer.empty() == true)
+				mask_buffer.resize(MASK_BUFFER_SIZE);
+
+			std::vector<boost::asio::const_buffer> pieces;
+			size_t used = 0;
+
+			for (size_t i = 0; i < buffers.size(); i++)
+			{
+				if (masks[i] == nullptr)
+				{
+					pieces.push_back(buffers[i]);
+					continue;
+				}
 
-			// SEND
-			socket->write_some(boost::asio::buffer(header)); // SEND HEADER
-			socket->write_some(boost::asio::buffer(mask)); // SEND MASK
-			socket->write_some(boost::asio::buffer(masked_data)); // SEND MASKED DATA
+				const std::array<unsigned char, 4> &mask = *masks[i];
+				const unsigned char *data = boost::asio::buffer_cast<const unsigned char*>(buffers[i]);
+				size_t size = boost::asio::buffer_size(buffers[i]);
+
+				for (size_t offset = 0; offset < size;)
+				{
+					// THE BUFFER IS FULL, THEN WRITE
+					if (used == mask_buffer.size())
+					{
+						boost::asio::write(*socket, pieces);
+						pieces.clear();
+						used = 0;
+					}
+
+					// MASK A CHUNK
+					size_t piece_size = std::min(size - offset, mask_buffer.size() - used);
+					WebSocketUtil::mask(mask_buffer.data() + used, data + offset, piece_size, mask, offset);
+
+					pieces.push_back(boost::asio::buffer(mask_buffer.data() + used, piece_size));
+					used += piece_size;
+					offset += piece_size;
+				}
+			}
+
+			if (pieces.empty() == false)
+				boost::asio::write(*socket, pieces);
 		};
 	};
 };
-};
\ No newline at end of file
+};
@@ -52,8 +52,16 @@ namespace protocol
 	private:
 		typedef Server super;
 
+		/**
+		 * Maximum size of a handshake header from web-client.
+		 */
+		static const size_t MAX_HEADER_SIZE = 8192;
+
 		size_t sequence;
 
+		bool compression;
+		bool context_takeover;
+
 	public:
 		/**
 		 * Default Constructor.
@@ -62,12 +70,40 @@ namespace protocol
 			: super()
 		{
 			sequence = 0;
+
+			compression = false;
+			context_takeover = true;
 		};
 		virtual ~WebServer() = default;
 
+		/**
+		 * Set compression.
+		 *
+		 * Accepts the *permessage-deflate* extension offered by web-clients, so that messages of both directions are 
+		 * compressed. Web browsers offer the extension by default. Call this method before {@link open opening} the 
+		 * server.
+		 *
+		 * *Context takeover* makes compression ratio better by referring previous messages, but each connection holds 
+		 * memory of compression, about 300 KB. Turn it off to save memory of servers with many clients.
+		 *
+		 * @param flag Whether to accept the *permessage-deflate* extension.
+		 * @param context_takeover Whether to allow *context takeover*.
+		 */
+		void setCompression(bool flag, bool context_takeover = true)
+		{
+			this->compression = flag;
+			this->context_takeover = context_takeover;
+		};
+
 	private:
 		virtual void handle_connection(std::shared_ptr<boost::asio::ip::tcp::socket> socket) override
 		{
+			if (getPoolSize() != 0)
+			{
+				handle_connection_async(socket);
+				return;
+			}
+
 			std::array<char, 1000> byte_array;
 			boost::system::error_code error;
 
@@ -81,6 +117,63 @@ namespace protocol
 			// HEADER FROM CLIENT
 			WeakString header(byte_array.data(), size);
 
+			///////
+			// SEND HEADER
+			///////
+			std::string reply_header;
+			std::shared_ptr<WebClientDriver> driver = handshake(socket, header, reply_header);
+
+			// SEND
+			socket->write_some(boost::asio::buffer(reply_header), error);
+			if (error)
+				return;
+
+			///////
+			// ADD CLIENT
+			///////
+			_Add_client(driver);
+		};
+
+		void handle_connection_async(std::shared_ptr<boost::asio::ip::tcp::socket> socket)
+		{
+			std::shared_ptr<boost::asio::streambuf> buffer(new boost::asio::streambuf(MAX_HEADER_SIZE));
+
+			///////
+			// LISTEN HEADER
+			///////
+			boost::asio::async_read_until(*socket, *buffer, "\r\n\r\n", [this, socket, buffer](const boost::system::error_code &error, size_t size)
+			{
+				if (error)
+					return;
+
+				// HEADER FROM CLIENT
+				std::string header
+				(
+					boost::asio::buffers_begin(buffer->data()), 
+					boost::asio::buffers_begin(buffer->data()) + size
+				);
+
+				///////
+				// SEND HEADER
+				///////
+				std::shared_ptr<std::string> reply_header(new std::string());
+				std::shared_ptr<WebClientDriver> driver = handshake(socket, header, *reply_header);
+
+				boost::asio::async_write(*socket, boost::asio::buffer(*reply_header), [this, driver, reply_header](const boost::system::error_code &error, size_t)
+				{
+					if (error)
+						return;
+
+					///////
+					// ADD CLIENT
+					///////
+					_Add_client(driver);
+				});
+			});
+		};
+
+		auto handshake(std::shared_ptr<boost::asio::ip::tcp::socket> socket, WeakString header, std::string &reply_header) -> std::shared_ptr<WebClientDriver>
+		{
 			// KEY VALUES
 			WeakString path = header.between("", "\r\n").between(" /", " HTTP");
 			std::string session_id;
@@ -94,6 +187,13 @@ namespace protocol
 			if (encrypted_cert_key.find("\r") != std::string::npos)
 				encrypted_cert_key = encrypted_cert_key.between("", "\r");
 
+			// PERMESSAGE-DEFLATE
+			std::unique_ptr<WebSocketDeflate> compressor;
+			std::string extension;
+
+			if (compression == true && header.find("Sec-WebSocket-Extensions:") != std::string::npos)
+				compressor = WebSocketDeflate::accept(header.between("Sec-WebSocket-Extensions:", "\r\n"), context_takeover, extension);
+
 			if (header.find("Set-Cookie: ") != std::string::npos)
 			{
 				cookie = header.between("Set-Cookie: ", "\r\n");
@@ -126,11 +226,10 @@ namespace protocol
 				cookie = "SESSION_ID=" + session_id;
 			}
 
-			///////
-			// SEND HEADER
 			///////
 			// CONSTRUCT REPLY MESSAGE
-			std::string &reply_header = library::StringUtil::substitute
+			///////
+			reply_header = library::StringUtil::substitute
 			(
 				std::string("") +
 				"HTTP/1.1 101 Switching Protocols\r\n" +
@@ -138,27 +237,23 @@ namespace protocol
 				"Connection: Upgrade\r\n" +
 				"Set-Cookie: {1}\r\n" +
 				"Sec-WebSocket-Accept: {2}\r\n" +
+				"{3}" + // extension
 				"\r\n",
 
 				cookie,
-				WebSocketUtil::encode_certification_key(encrypted_cert_key)
+				WebSocketUtil::encode_certification_key(encrypted_cert_key),
+				extension.empty() ? "" : "Sec-WebSocket-Extensions: " + extension + "\r\n"
 			);
 
-			// SEND
-			socket->write_some(boost::asio::buffer(reply_header), error);
-			if (error)
-				return;
-
-			///////
-			// ADD CLIENT
 			///////
 			// CREATE DRIVER
+			///////
 			std::shared_ptr<WebClientDriver> driver(new WebClientDriver(socket));
 			driver->session_id = session_id;
 			driver->path = path.str();
+			driver->compressor = std::move(compressor);
 
-			// ADD CLIENT
-			addClient(driver);
+			return driver;
 		};
 		
 		auto issue_session_id() -> std::string
@@ -51,14 +51,35 @@ namespace protocol
 		static std::map<std::pair<std::string, int>, std::string> s_cookies;
 		static library::RWMutex s_mtx;
 
+		bool compression;
+		bool context_takeover;
+
 	public:
 		WebServerConnector(IProtocol *listener)
 			: super(listener),
 			WebCommunicator(false)
 		{
+			compression = false;
+			context_takeover = true;
 		};
 		virtual ~WebServerConnector() = default;
 
+		/**
+		 * Set compression.
+		 *
+		 * Offers the *permessage-deflate* extension to the web-server in the handshake. If the web-server accepts the 
+		 * offer, messages of both directions are compressed. Call this method before {@link connect connect()}.
+		 *
+		 * @param flag Whether to offer the *permessage-deflate* extension.
+		 * @param context_takeover Whether to request *context takeover*, which makes compression ratio better, but 
+		 *						   holds memory of compression during the connection.
+		 */
+		void setCompression(bool flag, bool context_takeover = true)
+		{
+			this->compression = flag;
+			this->context_takeover = context_takeover;
+		};
+
 		/**
 		 * Connect to a web server.
 		 * 
@@ -143,12 +164,14 @@ namespace protocol
 				"{3}" + // cookie
 				"Sec-WebSocket-Key: {4}\r\n" + // hashed certification key
 				"Sec-WebSocket-Version: 13\r\n" +
+				"{5}" + // extension
 				"\r\n",
 
 				path.empty() ? "/" : "/" + path,
 				ip + ":" + std::to_string(port),
 				cookie,
-				base64_key
+				base64_key,
+				compression ? "Sec-WebSocket-Extensions: " + WebSocketDeflate::offer(context_takeover) + "\r\n" : ""
 			);
 			socket->write_some(boost::asio::buffer(query.data(), query.size()));
 
@@ -165,6 +188,11 @@ namespace protocol
 			if (sha1_key != server_sha1)
 				throw std::domain_error("WebSocket handshaking has failed.");
 
+			// PERMESSAGE-DEFLATE
+			compressor = nullptr;
+			if (compression == true && wstr.find("Sec-WebSocket-Extensions:") != std::string::npos)
+				compressor = WebSocketDeflate::confirm(wstr.between("Sec-WebSocket-Extensions:", "\r\n"));
+
 			// SET-COOKIE
 			if (wstr.find("Set-Cookie: ") != std::string::npos)
 			{
@@ -0,0 +1,389 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <string>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+#include <zlib.h>
+
+#include <samchon/ByteArray.hpp>
+#include <samchon/WeakString.hpp>
+
+namespace samchon
+{
+namespace protocol
+{
+	/**
+	 * Compressor of the web-socket *permessage-deflate* extension.
+	 *
+	 * The {@link WebSocketDeflate} compresses messages to send and decompresses messages received, following the
+	 * *permessage-deflate* extension of web-socket (RFC 7692). A {@link WebSocketDeflate} object is created when the
+	 * extension has been negotiated in the handshake, by {@link WebServer} and {@link WebServerConnector}, and is
+	 * owned by a {@link WebCommunicator}.
+	 *
+	 * With *context takeover*, compression of a message refers previous messages, thus compression ratio is better.
+	 * However, each connection holds memory of the sliding windows, about 300 KB. Without *context takeover*, the
+	 * zlib streams are created for each message and released after it, thus no memory is held between messages.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class WebSocketDeflate
+	{
+	private:
+		bool compress_context_takeover;
+		bool decompress_context_takeover;
+		int window_bits;
+
+		std::unique_ptr<z_stream> deflater;
+		std::unique_ptr<z_stream> inflater;
+
+	public:
+		/**
+		 * Default maximum size of a decompressed message, 64 MB.
+		 */
+		static const size_t MAX_SIZE = 64 * 1024 * 1024;
+
+		/**
+		 * Name of the extension.
+		 */
+		static auto NAME() -> std::string
+		{
+			return "permessage-deflate";
+		};
+
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from negotiated parameters.
+		 *
+		 * @param compress_context_takeover Whether to keep context of compression between messages to send.
+		 * @param decompress_context_takeover Whether to keep context of decompression between messages received.
+		 * @param window_bits Size of the sliding window for compression, in bits.
+		 */
+		WebSocketDeflate(bool compress_context_takeover, bool decompress_context_takeover, int window_bits = 15)
+		{
+			this->compress_context_takeover = compress_context_takeover;
+			this->decompress_context_takeover = decompress_context_takeover;
+
+			// RAW DEFLATE OF ZLIB SUPPORTS 9 ~ 15
+			this->window_bits = std::max(9, std::min(window_bits, 15));
+		};
+		~WebSocketDeflate()
+		{
+			end_deflater();
+			end_inflater();
+		};
+
+		/* ---------------------------------------------------------
+			NEGOTIATION
+		--------------------------------------------------------- */
+		/**
+		 * Offer of a client.
+		 *
+		 * @param context_takeover Whether to request *context takeover*.
+		 * @return Value of the *Sec-WebSocket-Extensions* header.
+		 */
+		static auto offer(bool context_takeover) -> std::string
+		{
+			std::string str = NAME() + "; client_max_window_bits";
+			if (context_takeover == false)
+				str += "; client_no_context_takeover; server_no_context_takeover";
+
+			return str;
+		};
+
+		/**
+		 * Accept an offer, by a server.
+		 *
+		 * Offers requesting a window the server cannot compress by, smaller than 9 bits, or having malformed
+		 * parameters are declined.
+		 *
+		 * @param offers Value of the *Sec-WebSocket-Extensions* header from a client.
+		 * @param context_takeover Whether to allow *context takeover*.
+		 * @param response Value of the *Sec-WebSocket-Extensions* header to reply. Empty if the offer is declined.
+		 * @return Compressor for the server, or *nullptr* if the client doesn't offer the extension.
+		 */
+		static auto accept(WeakString offers, bool context_takeover, std::string &response) -> std::unique_ptr<WebSocketDeflate>
+		{
+			response.clear();
+
+			// FIND AN ACCEPTABLE OFFER OF PERMESSAGE-DEFLATE
+			for (WeakString str : offers.split(","))
+			{
+				WeakString offer = str.trim();
+				if ((offer.between("", ";").trim() == NAME()) == false)
+					continue;
+
+				// RAW DEFLATE OF ZLIB COMPRESSES BY 9 ~ 15 BITS, WHEREAS RFC 7692 ALLOWS 8 ~ 15
+				int server_window_bits = parameter_value(offer, "server_max_window_bits", 15);
+				int client_window_bits = parameter_value(offer, "client_max_window_bits", 15);
+				if (server_window_bits < 9 || server_window_bits > 15 || client_window_bits < 8 || client_window_bits > 15)
+					continue;
+
+				bool server_context_takeover = context_takeover && !has_parameter(offer, "server_no_context_takeover");
+				bool client_context_takeover = context_takeover && !has_parameter(offer, "client_no_context_takeover");
+
+				// RESPONSE
+				response = NAME();
+				if (server_context_takeover == false)
+					response += "; server_no_context_takeover";
+				if (client_context_takeover == false)
+					response += "; client_no_context_takeover";
+				if (has_parameter(offer, "server_max_window_bits") == true)
+					response += "; server_max_window_bits=" + std::to_string(server_window_bits);
+
+				return std::unique_ptr<WebSocketDeflate>(new WebSocketDeflate(server_context_takeover, client_context_takeover, server_window_bits));
+			}
+			return nullptr;
+		};
+
+		/**
+		 * Confirm response of a server, by a client.
+		 *
+		 * @param response Value of the *Sec-WebSocket-Extensions* header from a server.
+		 * @return Compressor for the client, or *nullptr* if the server has declined the offer.
+		 *
+		 * @throw std::domain_error When the server requires a window the client cannot compress by.
+		 */
+		static auto confirm(WeakString response) -> std::unique_ptr<WebSocketDeflate>
+		{
+			response = response.trim();
+			if ((response.between("", ";").trim() == NAME()) == false)
+				return nullptr;
+
+			bool client_context_takeover = !has_parameter(response, "client_no_context_takeover");
+			bool server_context_takeover = !has_parameter(response, "server_no_context_takeover");
+			int client_window_bits = parameter_value(response, "client_max_window_bits", 15);
+
+			if (client_window_bits < 9 || client_window_bits > 15)
+				throw std::domain_error("Invalid client_max_window_bits of permessage-deflate.");
+
+			return std::unique_ptr<WebSocketDeflate>(new WebSocketDeflate(client_context_takeover, server_context_takeover, client_window_bits));
+		};
+
+		/* ---------------------------------------------------------
+			COMPRESSION
+		--------------------------------------------------------- */
+		/**
+		 * Compress a message to send.
+		 *
+		 * Messages must be compressed in order of sending, when *context takeover* is on.
+		 *
+		 * @param data Pointer of the message.
+		 * @param size Size of the message.
+		 * @return Compressed payload.
+		 */
+		auto compress(const unsigned char *data, size_t size) -> ByteArray
+		{
+			if (deflater == nullptr)
+			{
+				deflater.reset(new z_stream());
+				if (deflateInit2(deflater.get(), Z_DEFAULT_COMPRESSION, Z_DEFLATED, -window_bits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+				{
+					deflater.reset();
+					throw std::runtime_error("Failed to initialize zlib.");
+				}
+			}
+
+			ByteArray compressed;
+			compressed.resize(deflateBound(deflater.get(), (uLong)size) + 16);
+
+			deflater->next_in = (Bytef*)data;
+			deflater->avail_in = (uInt)size;
+
+			// FLUSH TO THE BYTE BOUNDARY, GROWING THE BUFFER IF REQUIRED
+			size_t completed = 0;
+			do
+			{
+				if (completed == compressed.size())
+					compressed.resize(compressed.size() * 2);
+
+				deflater->next_out = compressed.data() + completed;
+				deflater->avail_out = (uInt)(compressed.size() - completed);
+
+				if (::deflate(deflater.get(), Z_SYNC_FLUSH) == Z_STREAM_ERROR)
+					throw std::runtime_error("Failed to compress.");
+
+				completed = compressed.size() - deflater->avail_out;
+			}
+			while (deflater->avail_out == 0);
+
+			// THE EMPTY BLOCK OF THE SYNC FLUSH, 00 00 FF FF, IS OMITTED
+			if (completed >= 4 && compressed[completed - 2] == 0xFF && compressed[completed - 1] == 0xFF)
+				completed -= 4;
+			compressed.resize(completed);
+
+			if (compress_context_takeover == false)
+				end_deflater();
+
+			return compressed;
+		};
+
+		/**
+		 * Decompress a message received.
+		 *
+		 * @param data Pointer of the compressed payload.
+		 * @param size Size of the compressed payload.
+		 * @param max_size Maximum size of the decompressed message.
+		 * @return Decompressed message.
+		 *
+		 * @throw std::domain_error When the payload is not a valid deflate stream.
+		 * @throw std::length_error When the decompressed message exceeds the *max_size*.
+		 */
+		auto decompress(const unsigned char *data, size_t size, size_t max_size = MAX_SIZE) -> ByteArray
+		{
+			static const unsigned char TAIL[4] = { 0x00, 0x00, 0xFF, 0xFF };
+
+			if (inflater == nullptr)
+			{
+				inflater.reset(new z_stream());
+				if (inflateInit2(inflater.get(), -15) != Z_OK)
+				{
+					inflater.reset();
+					throw std::runtime_error("Failed to initialize zlib.");
+				}
+			}
+
+			ByteArray decompressed;
+			decompressed.resize(std::min<size_t>(std::max<size_t>(size * 4, 1024), max_size + 1));
+
+			// THE OMITTED TAIL IS APPENDED, UNLESS THE MESSAGE HAS ENDED BY A FINAL BLOCK
+			size_t completed = 0;
+			bool ended;
+			try
+			{
+				ended = inflate_data(data, size, max_size, decompressed, completed);
+				if (ended == false)
+					ended = inflate_data(TAIL, sizeof(TAIL), max_size, decompressed, completed);
+			}
+			catch (...)
+			{
+				// THE STREAM IS BROKEN
+				end_inflater();
+				throw;
+			}
+
+			decompressed.resize(completed);
+
+			if (decompress_context_takeover == false)
+				end_inflater();
+			else if (ended == true)
+				reset_inflater();
+
+			return decompressed;
+		};
+
+	private:
+		/**
+		 * @return Whether the deflate stream has ended by a final block.
+		 */
+		auto inflate_data(const unsigned char *data, size_t size, size_t max_size, ByteArray &decompressed, size_t &completed) -> bool
+		{
+			inflater->next_in = (Bytef*)data;
+			inflater->avail_in = (uInt)size;
+
+			while (true)
+			{
+				if (completed == decompressed.size())
+				{
+					if (completed > max_size)
+						throw std::length_error("Decompressed message is too large.");
+
+					decompressed.resize(std::min<size_t>(decompressed.size() * 2, max_size + 1));
+				}
+
+				inflater->next_out = decompressed.data() + completed;
+				inflater->avail_out = (uInt)(decompressed.size() - completed);
+
+				int result = ::inflate(inflater.get(), Z_SYNC_FLUSH);
+				completed = decompressed.size() - inflater->avail_out;
+
+				if (completed > max_size)
+					throw std::length_error("Decompressed message is too large.");
+				else if (result == Z_STREAM_END)
+					return true;
+				else if (result != Z_OK && result != Z_BUF_ERROR)
+					throw std::domain_error("Invalid compressed message.");
+				else if (inflater->avail_out == 0)
+					continue; // MORE OUTPUT MAY BE PENDING
+				else if (inflater->avail_in == 0)
+					return false;
+				else
+					throw std::domain_error("Invalid compressed message."); // NO PROGRESS
+			}
+		};
+
+		/**
+		 * Start a new deflate stream after a final block, keeping the sliding window.
+		 */
+		void reset_inflater()
+		{
+			ByteArray window;
+			window.resize(1 << 15);
+
+			uInt length = 0;
+			inflateGetDictionary(inflater.get(), window.data(), &length);
+			inflateReset(inflater.get());
+			inflateSetDictionary(inflater.get(), window.data(), length);
+		};
+
+		void end_deflater()
+		{
+			if (deflater == nullptr)
+				return;
+
+			deflateEnd(deflater.get());
+			deflater.reset();
+		};
+
+		void end_inflater()
+		{
+			if (inflater == nullptr)
+				return;
+
+			inflateEnd(inflater.get());
+			inflater.reset();
+		};
+
+		static auto has_parameter(WeakString extension, const std::string &name) -> bool
+		{
+			for (WeakString str : extension.split(";"))
+				if (str.between("", "=").trim() == name)
+					return true;
+
+			return false;
+		};
+
+		/**
+		 * @return Value of the parameter, *default_value* if it has no value, or 0 if the value is malformed.
+		 */
+		static auto parameter_value(WeakString extension, const std::string &name, int default_value) -> int
+		{
+			for (WeakString str : extension.split(";"))
+			{
+				if ((str.between("", "=").trim() == name) == false)
+					continue;
+				else if (str.find("=") == std::string::npos)
+					return default_value;
+
+				// ONE OR TWO DIGITS, WITHOUT STD::STOI WHICH THROWS
+				WeakString value = str.between("=").trim().trim("\"");
+				if (value.empty() == true || value.size() > 2)
+					return 0;
+
+				int number = 0;
+				for (size_t i = 0; i < value.size(); i++)
+					if (value[i] < '0' || value[i] > '9')
+						return 0;
+					else
+						number = number * 10 + (value[i] - '0');
+
+				return number;
+			}
+			return default_value;
+		};
+	};
+};
+};
@@ -2,9 +2,18 @@
 #include <samchon/API.hpp>
 
 #include <string>
+#include <array>
 #include <random>
+#include <cstring>
+#include <cstdint>
 #include <boost/uuid/sha1.hpp>
 
+#if defined(__AVX2__)
+#	include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	include <emmintrin.h>
+#endif
+
 #include <samchon/ByteArray.hpp>
 #include <samchon/library/Base64.hpp>
 #include <samchon/library/Date.hpp>
@@ -16,11 +25,17 @@ namespace protocol
 	class WebSocketUtil
 	{
 	public:
+		/**
+		 * Op-codes of frames, including the FIN bit.
+		 */
 		enum OpCode : unsigned char
 		{
+			CONTINUATION = 128,
 			TEXT = 129,
 			BINARY = 130,
-			DISCONNECT = 136
+			DISCONNECT = 136,
+			PING = 137,
+			PONG = 138
 		};
 
 		enum SizeCode : unsigned char
@@ -31,6 +46,81 @@ namespace protocol
 
 		static const unsigned char MASK = 128;
 
+		/**
+		 * Bit marking the last frame of a message.
+		 */
+		static const unsigned char FIN = 128;
+
+		/**
+		 * Bits of the op-code in the first byte of a frame.
+		 */
+		static const unsigned char OP_CODE_BITS = 15;
+
+		/**
+		 * Bit of op-codes of control frames; ping, pong and close.
+		 */
+		static const unsigned char CONTROL_BIT = 8;
+
+		/**
+		 * Bit marking a message compressed by the *permessage-deflate* extension.
+		 */
+		static const unsigned char RSV1 = 64;
+
+		/**
+		 * Mask or unmask data.
+		 *
+		 * XORs the *source* with the *key* repeatedly and writes the result on the *destination*. The *destination* 
+		 * can be same with the *source*, to unmask in place. Bytes are processed in words of SIMD registers, AVX2 or 
+		 * SSE2 if the compiler targets them, and 8 bytes otherwise.
+		 *
+		 * @param destination Pointer to write the result.
+		 * @param source Pointer of data to mask.
+		 * @param size Size of the data.
+		 * @param key Masking key.
+		 * @param offset Offset of the *source* in the whole payload, to continue masking of a chunk.
+		 */
+		static void mask(unsigned char *destination, const unsigned char *source, size_t size, const std::array<unsigned char, 4> &key, size_t offset = 0)
+		{
+			// ROTATE THE KEY BY THE OFFSET
+			std::array<unsigned char, 8> rotated;
+			for (size_t i = 0; i < rotated.size(); i++)
+				rotated[i] = key[(offset + i) % 4];
+
+			uint32_t word;
+			uint64_t double_word;
+			memcpy(&word, rotated.data(), sizeof(word));
+			memcpy(&double_word, rotated.data(), sizeof(double_word));
+
+			size_t i = 0;
+
+#if defined(__AVX2__)
+			__m256i key_256 = _mm256_set1_epi32((int)word);
+			for (; i + 32 <= size; i += 32)
+			{
+				__m256i data = _mm256_loadu_si256((const __m256i*)(source + i));
+				_mm256_storeu_si256((__m256i*)(destination + i), _mm256_xor_si256(data, key_256));
+			}
+#endif
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+			__m128i key_128 = _mm_set1_epi32((int)word);
+			for (; i + 16 <= size; i += 16)
+			{
+				__m128i data = _mm_loadu_si128((const __m128i*)(source + i));
+				_mm_storeu_si128((__m128i*)(destination + i), _mm_xor_si128(data, key_128));
+			}
+#endif
+			// WORD BY WORD, AND THE REST BYTES
+			for (; i + 8 <= size; i += 8)
+			{
+				uint64_t data;
+				memcpy(&data, source + i, sizeof(data));
+				data ^= double_word;
+				memcpy(destination + i, &data, sizeof(data));
+			}
+			for (; i < size; i++)
+				destination[i] = source[i] ^ rotated[i % 4];
+		};
+
 		static auto GUID() -> std::string
 		{
 			return "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
@@ -167,6 +167,16 @@ namespace distributed
 			super::construct(xml);
 		};
 
+		virtual void construct(library::XMLReader &reader) override
+		{
+			// CLEAR ORDINARY ROLES
+			process_map_.clear();
+
+			// ROLES AND SYSTEMS, IN ORDER OF THEIR ELEMENTS
+			this->constructElements(reader);
+			this->reindexRoles();
+		};
+
 	protected:
 		/**
 		 * Factory method creating a child {@link DistributedProcess process} object.
@@ -176,6 +186,41 @@ namespace distributed
 		 */
 		virtual auto createProcess(std::shared_ptr<library::XML>) -> DistributedProcess* = 0;
 
+		/**
+		 * Construct an element, from an XML reader.
+		 *
+		 * Constructs {@link DistributedProcess processes} from the *processes* element, one by one as they're read.
+		 * Other elements are constructed by {@link ParallelSystemArray}.
+		 *
+		 * @param reader A reader on the start tag of the element.
+		 */
+		virtual void constructElement(library::XMLReader &reader) override
+		{
+			if (reader.getTag() != "processes")
+			{
+				super::constructElement(reader);
+				return;
+			}
+
+			// CREATE ROLES
+			while (reader.read() == library::XMLReader::START_ELEMENT)
+			{
+				if (reader.getTag() != "process")
+				{
+					reader.skip();
+					continue;
+				}
+
+				// CONSTRUCT ROLE FROM THE READER
+				std::shared_ptr<DistributedProcess> role(createProcess(reader.getElement()));
+				protocol::EntityBase *entity = role.get();
+				entity->construct(reader);
+
+				// AND INSERT TO ROLE_MAP
+				insertProcess(role);
+			}
+		};
+
 		/* ---------------------------------------------------------
 			HISTORY HANDLER - PERFORMANCE ESTIMATION, INTERNAL
 		--------------------------------------------------------- */
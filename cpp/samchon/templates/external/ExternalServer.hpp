@@ -83,14 +83,16 @@ namespace external
 
 			connector->connect(ip, port);
 
-			// AFTER DISCONNECTION, ERASE THIS OBJECT
-			protocol::SharedEntityDeque<ExternalSystem> *systemArray = (protocol::SharedEntityDeque<ExternalSystem>*)system_array_;
+			// AFTER DISCONNECTION, ERASE THIS OBJECT; MEMBERS ARE NOT ACCESSIBLE AFTER THE ERASE
+			base::ExternalSystemArrayBase *system_array = system_array_;
+			protocol::SharedEntityDeque<ExternalSystem> *systemArray = (protocol::SharedEntityDeque<ExternalSystem>*)system_array;
 			for (size_t i = 0; i < systemArray->size(); i++)
 				if (systemArray->at(i).get() == this)
 				{
 					systemArray->erase(systemArray->begin() + i);
 					break;
 				}
+			system_array->reindexRoles();
 		};
 	};
 };
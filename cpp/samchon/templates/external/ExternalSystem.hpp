@@ -11,6 +11,9 @@
 
 #include <samchon/protocol/ClientDriver.hpp>
 
+#include <unordered_map>
+#include <atomic>
+
 namespace samchon
 {
 namespace templates
@@ -68,6 +71,19 @@ namespace external
 		 */
 		std::string name;
 
+	private:
+		typedef std::vector<std::shared_ptr<ExternalSystemRole>> route_type;
+
+		/**
+		 * Roles of each listener. Routes are replaced, not modified, when built again; a route being iterated is 
+		 * kept alive by its holder.
+		 */
+		std::unordered_map<std::string, std::shared_ptr<route_type>> route_map_;
+		std::shared_ptr<route_type> broadcast_roles_;
+
+		size_t routed_size_;
+		std::atomic<bool> routed_;
+
 	public:
 		/* ---------------------------------------------------------
 			CONSTRUCTORS
@@ -79,6 +95,7 @@ namespace external
 			: super()
 		{
 			this->system_array_ = nullptr;
+			this->routed_ = false;
 		}
 
 		/**
@@ -90,6 +107,7 @@ namespace external
 			: super()
 		{
 			this->system_array_ = systemArray;
+			this->routed_ = false;
 		};
 
 		/**
@@ -99,8 +117,11 @@ namespace external
 		 * @param communicator Communicator with the remote, external system.
 		 */
 		ExternalSystem(base::ExternalSystemArrayBase *systemArray, std::shared_ptr<protocol::ClientDriver> driver)
+			: super()
 		{
+			this->system_array_ = systemArray;
 			this->communicator_ = driver;
+			this->routed_ = false;
 		};
 
 		/**
@@ -124,6 +145,33 @@ namespace external
 			}
 
 			super::construct(xml);
+			reindexRoles();
+		};
+
+		/**
+		 * Construct from an XML reader.
+		 *
+		 * An XML object of the system is built and passed to {@link construct construct()}, which may be overridden 
+		 * to construct members of a derived system, too. A system has a few roles.
+		 */
+		virtual void construct(library::XMLReader &reader) override
+		{
+			protocol::EntityBase::construct(reader);
+		};
+
+		/**
+		 * Invalidate routes and index of roles.
+		 *
+		 * Routes from listeners to roles, and index of roles in the parent {@link ExternalSystemArray}, are built 
+		 * again on the next use. Call it after inserting or erasing roles directly, or after a role has declared a
+		 * new listener.
+		 */
+		void reindexRoles()
+		{
+			routed_ = false;
+
+			if (system_array_ != nullptr)
+				system_array_->reindexRoles();
 		};
 
 	public:
@@ -173,18 +221,69 @@ namespace external
 		/**
 		 * Handle an {@Invoke} message has received.
 		 * 
+		 * The message is shifted to {@link ExternalSystemRole roles} handling its 
+		 * {@link Invoke.getListener listener}, by a hash index, and then to the parent {@link ExternalSystemArray}. 
+		 * Roles which have not declared {@link ExternalSystemRole.getListeners listeners} handle all the messages.
+		 * 
 		 * @param invoke An {@link Invoke} message have received.
 		 */
 		virtual void replyData(std::shared_ptr<protocol::Invoke> invoke) override
 		{
-			// SHIFT TO ROLES
-			for (size_t i = 0; i < size(); i++)
-				at(i)->replyData(invoke);
+			// SHIFT TO ROLES HANDLING THE LISTENER, WHO MAY ADD OR REMOVE ROLES
+			std::shared_ptr<const route_type> roles = route(invoke->getListener());
+			for (size_t i = 0; i < roles->size(); i++)
+				roles->at(i)->replyData(invoke);
 
 			// SHIFT TO SYSTEM_ARRAY
 			((IProtocol*)system_array_)->replyData(invoke);
 		};
 
+	private:
+		auto route(const std::string &listener) -> std::shared_ptr<const route_type>
+		{
+			// BUILD ROUTES IF INVALIDATED, OR ROLES HAVE BEEN MODIFIED DIRECTLY
+			if (routed_ == false || routed_size_ != size())
+				build_routes();
+
+			auto it = route_map_.find(listener);
+			if (it == route_map_.end())
+				return broadcast_roles_;
+			else
+				return it->second;
+		};
+
+		void build_routes()
+		{
+			// NEW ROUTES, THE OLD ONES MAY BE BEING ITERATED
+			route_map_.clear();
+			broadcast_roles_ = std::make_shared<route_type>();
+
+			// LISTENERS DECLARED BY ROLES
+			for (size_t i = 0; i < size(); i++)
+				for (auto it = at(i)->getListeners().begin(); it != at(i)->getListeners().end(); it++)
+					if (route_map_.find(*it) == route_map_.end())
+						route_map_[*it] = std::make_shared<route_type>();
+
+			// ROLES OF EACH LISTENER, IN ORDER
+			for (size_t i = 0; i < size(); i++)
+			{
+				const std::shared_ptr<ExternalSystemRole> &role = at(i);
+
+				if (role->getListeners().empty() == true)
+				{
+					broadcast_roles_->push_back(role);
+					for (auto it = route_map_.begin(); it != route_map_.end(); it++)
+						it->second->push_back(role);
+				}
+				else
+					for (auto it = role->getListeners().begin(); it != role->getListeners().end(); it++)
+						route_map_[*it]->push_back(role);
+			}
+
+			routed_size_ = size();
+			routed_ = true;
+		};
+
 	public:
 		/* ---------------------------------------------------------
 			EXPORTERS
@@ -5,9 +5,14 @@
 #	include <samchon/templates/external/ExternalSystem.hpp>
 #include <samchon/templates/external/base/ExternalSystemArrayBase.hpp>
 #include <samchon/protocol/IProtocol.hpp>
+#include <samchon/protocol/InvokeFrame.hpp>
+#include <samchon/library/ThreadPool.hpp>
 
 #include <vector>
 #include <thread>
+#include <mutex>
+#include <cstdint>
+#include <unordered_map>
 
 namespace samchon
 {
@@ -73,6 +78,10 @@ namespace external
 	private:
 		typedef protocol::SharedEntityDeque<System> super;
 
+		mutable std::mutex role_mtx_;
+		mutable std::unordered_map<std::string, std::weak_ptr<ExternalSystemRole>> role_map_;
+		mutable size_t role_map_version_;
+
 	public:
 		/* ---------------------------------------------------------
 			CONSTRUCTORS
@@ -83,12 +92,31 @@ namespace external
 		ExternalSystemArray()
 			: super()
 		{
+			role_map_version_ = SIZE_MAX;
 		};
 
 		/**
 		 * Default Destructor.
 		 */
 		virtual ~ExternalSystemArray() = default;
+
+		virtual void construct(std::shared_ptr<library::XML> xml) override
+		{
+			super::construct(xml);
+			reindexRoles();
+		};
+
+		virtual void construct(library::XMLReader &reader) override
+		{
+			super::construct(reader);
+			reindexRoles();
+		};
+
+		virtual void construct(const ByteArray &data) override
+		{
+			super::construct(data);
+			reindexRoles();
+		};
 		
 	public:
 		/* ---------------------------------------------------------
@@ -97,18 +125,16 @@ namespace external
 		/**
 		 * Test whether the role exists.
 		 * 
+		 * Roles are looked up by a hash index of their names, which is built again after 
+		 * {@link reindexRoles systems or roles have been changed}.
+		 * 
 		 * @param name Name, identifier of target {@link ExternalSystemRole role}.
 		 * 
 		 * @return Whether the role has or not.
 		 */
 		auto hasRole(const std::string &key) const -> bool
 		{
-			for (size_t i = 0; i < size(); i++)
-				for (size_t j = 0; j < at(i)->size(); j++)
-					if (at(i)->at(j)->key() == key)
-						return true;
-
-			return false;
+			return find_role(key) != nullptr;
 		};
 
 		/**
@@ -120,12 +146,11 @@ namespace external
 		 */
 		auto getRole(const std::string &key) const -> std::shared_ptr<ExternalSystemRole>
 		{
-			for (size_t i = 0; i < size(); i++)
-				for (size_t j = 0; j < at(i)->size(); j++)
-					if (at(i)->at(j)->key() == key)
-						return at(i)->at(j);
+			std::shared_ptr<ExternalSystemRole> role = find_role(key);
+			if (role == nullptr)
+				throw std::out_of_range("No such key.");
 
-			throw std::out_of_range("No such key.");
+			return role;
 		};
 
 		virtual auto _Get_children() const -> std::vector<std::shared_ptr<ExternalSystem>>
@@ -134,26 +159,54 @@ namespace external
 			return children;
 		};
 
+	private:
+		auto find_role(const std::string &key) const -> std::shared_ptr<ExternalSystemRole>
+		{
+			std::unique_lock<std::mutex> uk(role_mtx_);
+
+			// BUILD THE INDEX, IF SYSTEMS OR ROLES HAVE BEEN CHANGED
+			size_t version = role_version_;
+			if (role_map_version_ != version)
+			{
+				role_map_.clear();
+				for (size_t i = 0; i < size(); i++)
+					for (size_t j = 0; j < at(i)->size(); j++)
+						role_map_.emplace(at(i)->at(j)->key(), at(i)->at(j)); // THE FIRST ONE HAS PRIORITY
+
+				role_map_version_ = version;
+			}
+
+			auto it = role_map_.find(key);
+			if (it == role_map_.end())
+				return nullptr;
+			else
+				return it->second.lock(); // NULL IF THE SYSTEM HAS LEFT
+		};
+
+	public:
 		/* ---------------------------------------------------------
 			MESSAGE CHAIN
 		--------------------------------------------------------- */
 		/**
 		 * Send an {@link Invoke} message.
 		 * 
+		 * The message is sent to all the systems in parallel, on the {@link library::ThreadPool.shared shared pool}.
+		 * It's encoded once and shared by the systems, through an {@link protocol::InvokeFrame}.
+		 * 
 		 * @param invoke An {@link Invoke} message to send.
 		 */
 		virtual void sendData(std::shared_ptr<protocol::Invoke> invoke)
 		{
-			std::vector<std::thread> threads;
+			protocol::InvokeFrame::Scope scope(invoke);
+
 			library::UniqueReadLock uk(getMutex());
-			
-			threads.reserve(this->size());
-			for (size_t i = 0; i < size(); i++)
-				threads.emplace_back(&ExternalSystem::sendData, at(i).get(), invoke);
-			
+			std::vector<std::shared_ptr<System>> systems(begin(), end());
 			uk.unlock();
-			for (auto it = threads.begin(); it != threads.end(); it++)
-				it->join();
+
+			library::ThreadPool::shared().forEach(systems.begin(), systems.end(), [&invoke](std::shared_ptr<System> &system)
+			{
+				system->sendData(invoke);
+			});
 		};
 
 		/**
@@ -4,6 +4,8 @@
 #include <samchon/protocol/Entity.hpp>
 #include <samchon/protocol/IProtocol.hpp>
 
+#include <unordered_set>
+
 namespace samchon
 {
 namespace templates
@@ -65,6 +67,9 @@ namespace external
 		 */
 		std::string name;
 
+	private:
+		std::unordered_set<std::string> listeners_;
+
 	public:
 		/* ---------------------------------------------------------
 			CONSTRUCTORS
@@ -116,6 +121,33 @@ namespace external
 			return name;
 		};
 
+		/**
+		 * Get names of listeners this role handles.
+		 *
+		 * Empty means the role handles all {@link Invoke} messages.
+		 */
+		auto getListeners() const -> const std::unordered_set<std::string>&
+		{
+			return listeners_;
+		};
+
+	protected:
+		/**
+		 * Declare a listener this role handles.
+		 *
+		 * Once a role declares listeners, the parent {@link ExternalSystem} shifts only {@link Invoke} messages 
+		 * whose {@link Invoke.getListener listeners} are declared to {@link replyData replyData()} of the role. A 
+		 * role declaring nothing receives all of them. Declare them in constructor; if they're declared after the 
+		 * role has been inserted, call {@link ExternalSystem.reindexRoles ExternalSystem.reindexRoles()}.
+		 *
+		 * @param listener Name of a listener.
+		 */
+		void addListener(const std::string &listener)
+		{
+			listeners_.insert(listener);
+		};
+
+	public:
 		/* ---------------------------------------------------------
 			MESSAGE CHAIN
 		--------------------------------------------------------- */
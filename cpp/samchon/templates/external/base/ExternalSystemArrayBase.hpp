@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <memory>
+#include <atomic>
 #include <samchon/library/RWMutex.hpp>
 
 namespace samchon
@@ -20,9 +21,31 @@ namespace base
 	private:
 		library::RWMutex mtx;
 
+	protected:
+		/**
+		 * Version of systems and their roles, increased whenever they're changed.
+		 */
+		std::atomic<size_t> role_version_;
+
 	public:
+		ExternalSystemArrayBase()
+		{
+			role_version_ = 0;
+		};
+
 		virtual auto _Get_children() const -> std::vector<std::shared_ptr<ExternalSystem>> = 0;
 
+		/**
+		 * Invalidate index of roles.
+		 *
+		 * Index of roles is built again on the next lookup. It's called when an external system joins or leaves, and 
+		 * must be called when roles of a system are inserted or erased directly.
+		 */
+		void reindexRoles()
+		{
+			role_version_++;
+		};
+
 		auto getMutex() -> library::RWMutex& { return mtx; };
 		auto getMutex() const -> const library::RWMutex& { return mtx; };
 	};
@@ -64,12 +64,12 @@ namespace parallel
 
 		virtual ~PRInvokeHistory() = default;
 
-		virtual void construct(std::shared_ptr<library::XML> xml) override
+		virtual void archive(protocol::EntityArchive &archive) override
 		{
-			super::construct(xml);
+			super::archive(archive);
 
-			first_ = xml->getProperty<size_t>("first");
-			last_ = xml->getProperty<size_t>("last");
+			archive.field("first", first_);
+			archive.field("last", last_);
 		};
 
 		/* ---------------------------------------------------------
@@ -108,18 +108,6 @@ namespace parallel
 		{
 			return last_ - first_;
 		};
-
-		/* ---------------------------------------------------------
-			EXPORTERS
-		--------------------------------------------------------- */
-		virtual auto toXML() const -> std::shared_ptr<library::XML> override
-		{
-			std::shared_ptr<library::XML> &xml = super::toXML();
-			xml->setProperty("first", first_);
-			xml->setProperty("last", last_);
-
-			return xml;
-		};
 	};
 };
 };
@@ -3,6 +3,7 @@
 
 #include <samchon/templates/external/ExternalSystem.hpp>
 #include <samchon/protocol/IListener.hpp>
+#include <samchon/protocol/InvokeDispatcher.hpp>
 
 #include <samchon/templates/parallel/base/ParallelSystemArrayBase.hpp>
 
@@ -212,17 +213,13 @@ namespace parallel
 	protected:
 		virtual void _Reply_data(std::shared_ptr<protocol::Invoke> invoke) override
 		{
-			if (invoke->getListener() == "_Report_history")
-				_Report_history(invoke->front()->getValueAsXML());
-			else if (invoke->getListener() == "_Send_back_history")
-			{
-				size_t uid = invoke->front()->getValue<size_t>();
-				auto it = progress_list_.find(uid);
+			static const protocol::InvokeDispatcher<ParallelSystem> dispatcher
+			({
+				{ "_Report_history", &ParallelSystem::_Report_history },
+				{ "_Send_back_history", &ParallelSystem::send_back_history }
+			});
 
-				if (it != progress_list_.end())
-					_Send_back_history(it->second.first, it->second.second);
-			}
-			else
+			if (dispatcher.dispatch(this, invoke) == false)
 				replyData(invoke);
 		};
 
@@ -279,6 +276,15 @@ namespace parallel
 			progress_list_.erase(history->getUID());
 		};
 
+	private:
+		void send_back_history(size_t uid)
+		{
+			auto it = progress_list_.find(uid);
+
+			if (it != progress_list_.end())
+				_Send_back_history(it->second.first, it->second.second);
+		};
+
 	public:
 		/* ---------------------------------------------------------
 			EXPORTERS
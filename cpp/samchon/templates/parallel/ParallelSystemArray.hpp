@@ -186,10 +186,10 @@ namespace parallel
 
 			// SYSTEMS TO BE GET DIVIDED PROCESSES AND
 			std::vector<std::shared_ptr<ParallelSystem>> system_array;
-			std::vector<std::thread> threads;
+			std::vector<std::pair<ParallelSystem*, std::shared_ptr<protocol::Invoke>>> orders;
 			
 			system_array.reserve(size());
-			threads.reserve(size());
+			orders.reserve(size());
 			
 			// POP EXCLUDEDS
 			for (size_t i = 0; i < size(); i++)
@@ -224,17 +224,18 @@ namespace parallel
 				std::shared_ptr<slave::InvokeHistory> history(new PRInvokeHistory(my_invoke));
 				system->_Get_progress_list().emplace(history->getUID(), std::make_pair(invoke, history));
 
-				// ENROLL THE SEND DATA INTO THREADS
-				threads.emplace_back(&ParallelSystem::sendData, system.get(), my_invoke);
+				// ENROLL THE SEND DATA INTO ORDERS
+				orders.emplace_back(system.get(), my_invoke);
 				first += piece_size; // FOR THE NEXT STEP
 			}
 			uk.unlock();
 
-			// JOIN THREADS
-			for (auto it = threads.begin(); it != threads.end(); it++)
-				it->join();
-
-			return threads.size();
+			// SEND THEM ON THE SHARED POOL
+			typedef std::pair<ParallelSystem*, std::shared_ptr<protocol::Invoke>> Order;
+			return library::ThreadPool::shared().forEach(orders.begin(), orders.end(), [](Order &order)
+			{
+				order.first->sendData(order.second);
+			});
 		};
 
 		/* ---------------------------------------------------------
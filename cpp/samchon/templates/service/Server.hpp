@@ -3,12 +3,15 @@
 
 #include <samchon/protocol/WebServer.hpp>
 #include <samchon/protocol/IProtocol.hpp>
+#include <samchon/protocol/InvokeFrame.hpp>
 
 #include <samchon/templates/service/User.hpp>
 
 #include <thread>
+#include <boost/asio/steady_timer.hpp>
 #include <samchon/HashMap.hpp>
 #include <samchon/library/RWMutex.hpp>
+#include <samchon/library/ThreadPool.hpp>
 
 namespace samchon
 {
@@ -141,16 +144,20 @@ namespace service
 		 */
 		virtual void sendData(std::shared_ptr<protocol::Invoke> invoke) override
 		{
-			std::vector<std::thread> threadArray;
+			protocol::InvokeFrame::Scope scope(invoke); // ENCODED ONCE FOR ALL THE CLIENTS
+
+			std::vector<std::shared_ptr<User>> userArray;
 			library::UniqueReadLock uk(session_map_mtx);
 
-			threadArray.reserve(session_map.size());
+			userArray.reserve(session_map.size());
 			for (auto it = session_map.begin(); it != session_map.end(); it++)
-				threadArray.emplace_back(&User::sendData, it->second.get(), invoke);
+				userArray.push_back(it->second);
 
 			uk.unlock();
-			for (auto it = threadArray.begin(); it != threadArray.end(); it++)
-				it->join();
+			library::ThreadPool::shared().forEach(userArray.begin(), userArray.end(), [&invoke](std::shared_ptr<User> &user)
+			{
+				user->sendData(invoke);
+			});
 		};
 
 		/**
@@ -253,20 +260,44 @@ namespace service
 			///////
 			// BEGINS COMMUNICATION
 			///////
-			client->driver->listen(client.get());
+			std::weak_ptr<User> user_weak_ptr = user;
+			size_t no = client->no;
+
+			client->driver->onClose = [this, user_weak_ptr, no]()
+			{
+				std::shared_ptr<User> user = user_weak_ptr.lock();
+				if (user == nullptr)
+					return;
+
+				// DISCONNECTED - ERASE CLIENT.
+				{
+					library::UniqueWriteLock uk(user->mtx);
+					user->erase(no);
+				}
+
+				// IF THE USER HAS NO CLIENT LEFT, THEN THE USER WILL ALSO BE ERASED.
+				// IT WAITS UNTIL 30 SECONDS TO KEEP SESSION
+				boost::asio::io_service *io_service = _Get_io_service();
+				if (io_service == nullptr)
+				{
+					// THREAD OF THE CONNECTION, WHICH IS ENDING
+					std::this_thread::sleep_for(std::chrono::seconds(30));
+					user->check_empty();
+					return;
+				}
 
-			// DISCONNECTED - ERASE CLIENT.
-			// IF THE USER HAS NO CLIENT LEFT, THEN THE USER WILL ALSO BE ERASED.
-			user->erase(client->no);
-			user->check_empty();
+				// DON'T BLOCK THE POOL
+				std::shared_ptr<boost::asio::steady_timer> timer(new boost::asio::steady_timer(*io_service, std::chrono::seconds(30)));
+				timer->async_wait([user, timer](const boost::system::error_code &)
+				{
+					user->check_empty();
+				});
+			};
+			client->driver->listen(client.get());
 		};
 
 		void erase_user(User *user)
 		{
-			// USER DOESN'T BE ERASED AT THAT TIME
-			// IT WAITS UNTIL 30 SECONDS TO KEEP SESSION
-			std::this_thread::sleep_for(std::chrono::seconds(30));
-
 			if (user->empty() == false)
 			{
 				// ERASE FROM ACCOUNT_MAP
@@ -2,6 +2,7 @@
 #include <samchon/API.hpp>
 
 #include <samchon/protocol/IProtocol.hpp>
+#include <samchon/protocol/InvokeFrame.hpp>
 #include <samchon/TreeMap.hpp>
 #include <samchon/templates/service/Client.hpp>
 
@@ -9,6 +10,7 @@
 #include <functional>
 #include <thread>
 #include <samchon/library/RWMutex.hpp>
+#include <samchon/library/ThreadPool.hpp>
 
 namespace samchon
 {
@@ -228,16 +230,20 @@ namespace service
 		 */
 		virtual void sendData(std::shared_ptr<protocol::Invoke> invoke) override
 		{
-			std::vector<std::thread> threadArray;
+			protocol::InvokeFrame::Scope scope(invoke); // ENCODED ONCE FOR ALL THE CLIENTS
+
+			std::vector<std::shared_ptr<Client>> clientArray;
 			library::UniqueReadLock uk(mtx);
 
-			threadArray.reserve(size());
+			clientArray.reserve(size());
 			for (auto it = begin(); it != end(); it++)
-				threadArray.emplace_back(&Client::sendData, it->second.get(), invoke);
+				clientArray.push_back(it->second);
 
 			uk.unlock();
-			for (auto it = threadArray.begin(); it != threadArray.end(); it++)
-				it->join();
+			library::ThreadPool::shared().forEach(clientArray.begin(), clientArray.end(), [&invoke](std::shared_ptr<Client> &client)
+			{
+				client->sendData(invoke);
+			});
 		};
 
 		/**
@@ -65,22 +65,27 @@ namespace slave
 
 		virtual ~InvokeHistory() = default;
 
-		virtual void construct(std::shared_ptr<library::XML> xml) override
+		virtual void archive(protocol::EntityArchive &archive) override
 		{
 			// UID AND LISTENER
-			uid_ = xml->getProperty<size_t>("uid");
-			listener_ = xml->getProperty("listener");
+			archive.field("uid", uid_);
+			archive.field("listener", listener_);
 
 			//--------
 			// START AND END TIME
 			//--------
-			// INIT TIMES TO DEFAULT (0; 1970-01-01 09:00:00
-			start_time_ = std::chrono::system_clock::from_time_t(0);
-			end_time_ = std::chrono::system_clock::from_time_t(0);
-
-			// ADD NUMBERS WHO REPRESENT LINUX_TIME
-			start_time_ += std::chrono::duration<long long, std::ratio_multiply<std::ratio<100i64, 1i64>, std::nano>>(xml->getProperty<long long>("startTime"));
-			end_time_ += std::chrono::duration<long long, std::ratio_multiply<std::ratio<100i64, 1i64>, std::nano>>(xml->getProperty<long long>("endTime"));
+			// NUMBERS WHO REPRESENT TICKS FROM THE EPOCH
+			long long start_time = start_time_.time_since_epoch().count();
+			long long end_time = end_time_.time_since_epoch().count();
+
+			archive.field("startTime", start_time);
+			archive.field("endTime", end_time);
+
+			if (archive.getMode() == protocol::EntityArchive::LOAD)
+			{
+				start_time_ = std::chrono::system_clock::time_point(std::chrono::system_clock::duration(start_time));
+				end_time_ = std::chrono::system_clock::time_point(std::chrono::system_clock::duration(end_time));
+			}
 		};
 
 		/* ---------------------------------------------------------
@@ -153,18 +158,6 @@ namespace slave
 			return "history";
 		};
 
-		virtual auto toXML() const -> std::shared_ptr<library::XML> override
-		{
-			std::shared_ptr<library::XML> &xml = super::toXML();
-			xml->setProperty("uid", uid_);
-			xml->setProperty("listener", listener_);
-
-			xml->setProperty("startTime", start_time_.time_since_epoch().count());
-			xml->setProperty("endTime", end_time_.time_since_epoch().count());
-
-			return xml;
-		};
-
 		auto toInvoke() const -> std::shared_ptr<protocol::Invoke>
 		{
 			return std::make_shared<protocol::Invoke>("_Report_history", toXML());